@@ -0,0 +1,83 @@
+--&serverscript
+-- Actor scaling benchmark
+-- Spawns N actors, each running a Mandelbrot kernel in the parallel phase every frame,
+-- and reports kernels/second per N. Run with: moon-engine --path examples/benchmarks/actors_scaling.lua
+
+local Bench = require("./lib/bench")
+
+local ROUND_SECONDS = 3
+local ACTOR_COUNTS = { 1, 2, 4, 8, 16 }
+
+-- Runs inside each Actor's own VM
+local KERNEL = [[
+--&serverscript
+local actor = script.Parent
+local SIZE, ITER = 160, 100
+
+local function mandelbrot()
+	local inside = 0
+	for py = 0, SIZE - 1 do
+		local ci = py / SIZE * 2.4 - 1.2
+		for px = 0, SIZE - 1 do
+			local cr = px / SIZE * 3.0 - 2.1
+			local zr, zi, n = 0, 0, 0
+			while n < ITER and zr * zr + zi * zi < 4 do
+				zr, zi = zr * zr - zi * zi + cr, 2 * zr * zi + ci
+				n += 1
+			end
+			if n == ITER then inside += 1 end
+		end
+	end
+	return inside
+end
+
+local done = 0
+while true do
+	task.desynchronize()
+	mandelbrot()
+	done += 1
+	task.synchronize()
+	actor:SetAttribute("Done", done)
+end
+]]
+
+local function runRound(n)
+	local actors = {}
+	for i = 1, n do
+		local actor = Instance.new("Actor")
+		actor.Name = "BenchActor" .. i
+		actor.Parent = workspace
+
+		local s = Instance.new("Script")
+		s.Source = KERNEL
+		s.Parent = actor
+		s.Enabled = true -- schedules into the actor's VM
+
+		actors[i] = actor
+	end
+
+	-- let every actor get going before measuring
+	task.wait(0.5)
+	local function total()
+		local sum = 0
+		for _, a in actors do sum += (a:GetAttribute("Done") or 0) end
+		return sum
+	end
+
+	local startCount, stop = total(), Bench.start()
+	task.wait(ROUND_SECONDS)
+	local kernels, elapsed = total() - startCount, stop()
+
+	for _, a in actors do a:Destroy() end
+	return kernels / elapsed
+end
+
+print("[actors] kernel: 160x160 mandelbrot, 100 iterations")
+local baseline
+for _, n in ACTOR_COUNTS do
+	local rate = runRound(n)
+	baseline = baseline or rate
+	print(string.format("[actors] N=%-3d %8.1f kernels/s  speedup x%.2f", n, rate, rate / baseline))
+	task.wait(0.25)
+end
+print("[actors] done")
@@ -0,0 +1,68 @@
+--&serverscript
+-- Batch CFrame benchmark
+-- Compares per-element CFrame math in Lua with the buffer kernels (CFrame.batchMul,
+-- CFrame.batchLerp, CFrame.pointsToWorldSpace) over the same data, in ns per element.
+-- Packed CFrames are 12 f32 in GetComponents order (48 bytes), packed points 3 f32.
+-- Run with: moon-engine --headless --no-place --path examples/benchmarks/cframe_batch.lua
+
+local Bench = require("./lib/bench")
+
+local COUNT = 4096
+local ROUNDS = 50
+
+-- ns per element over ROUNDS passes of fn, which covers all COUNT elements
+local function bench(label, fn)
+	local seconds = Bench.time(ROUNDS, function(n) for _ = 1, n do fn() end end, 1)
+	local ns = seconds * 1e9 / COUNT
+	print(string.format("[batch]   %-20s %7.1f ns/elem", label, ns))
+	return ns
+end
+
+local function report(label, perElement, batched)
+	print(string.format("[batch] %-20s %7.1f ns/elem in Lua, %6.1f ns/elem batched (%.1fx)",
+		label, perElement, batched, perElement / batched))
+end
+
+local center = CFrame.new(0, 20, 0) * CFrame.Angles(0.1, 0.7, 0)
+local rel, goal, points = {}, {}, {}
+local relBuf = buffer.create(COUNT * 48)
+local goalBuf = buffer.create(COUNT * 48)
+local outBuf = buffer.create(COUNT * 48)
+local pointBuf = buffer.create(COUNT * 12)
+local pointOut = buffer.create(COUNT * 12)
+
+for i = 1, COUNT do
+	rel[i] = CFrame.new(i % 17, i % 5, -i % 11) * CFrame.Angles(i * 0.01, i * 0.02, i * 0.03)
+	goal[i] = CFrame.new(-i % 13, 4, i % 7) * CFrame.Angles(-i * 0.02, 0.5, i * 0.01)
+	points[i] = Vector3.new(i % 9, i % 4, i % 23)
+	CFrame.writeBuffer(relBuf, i - 1, rel[i])
+	CFrame.writeBuffer(goalBuf, i - 1, goal[i])
+	buffer.writef32(pointBuf, (i - 1) * 12, points[i].X)
+	buffer.writef32(pointBuf, (i - 1) * 12 + 4, points[i].Y)
+	buffer.writef32(pointBuf, (i - 1) * 12 + 8, points[i].Z)
+end
+
+local out = table.create(COUNT)
+
+report("center * rel[i]",
+	bench("mul", function() for i = 1, COUNT do out[i] = center * rel[i] end end),
+	bench("batchMul", function() CFrame.batchMul(center, relBuf, outBuf, COUNT) end))
+
+report("rel[i]:Lerp(goal[i])",
+	bench("lerp", function() for i = 1, COUNT do out[i] = rel[i]:Lerp(goal[i], 0.3) end end),
+	bench("batchLerp", function() CFrame.batchLerp(relBuf, goalBuf, outBuf, COUNT, 0.3) end))
+
+report("PointToWorldSpace",
+	bench("points", function() for i = 1, COUNT do out[i] = center:PointToWorldSpace(points[i]) end end),
+	bench("pointsToWorldSpace", function() CFrame.pointsToWorldSpace(center, pointBuf, pointOut, COUNT) end))
+
+-- The kernels run the same math as the per-element methods
+CFrame.batchMul(center, relBuf, outBuf, COUNT)
+local worst = 0
+for i = 1, COUNT do
+	local a, b = { (center * rel[i]):GetComponents() }, { CFrame.readBuffer(outBuf, i - 1):GetComponents() }
+	for k = 1, 12 do worst = math.max(worst, math.abs(a[k] - b[k])) end
+end
+print(string.format("[batch] batchMul max difference from per-element: %g", worst))
+
+print("[batch] done")
@@ -0,0 +1,55 @@
+--&serverscript
+-- CFrame math benchmark
+-- Times the CFrame operations scripts lean on every frame: composition, Inverse,
+-- PointToWorldSpace / PointToObjectSpace and Lerp, in ns per call from Lua.
+-- Run with: moon-engine --headless --no-place --path examples/benchmarks/cframe_math.lua
+
+local Bench = require("./lib/bench")
+
+local N = 200000
+
+local function bench(label, fn)
+	Bench.run("cframe", label, N, fn)
+end
+
+local a = CFrame.new(1, 2, 3) * CFrame.Angles(0.3, 1.1, -0.4)
+local b = CFrame.new(-4, 5, 9) * CFrame.Angles(-1.2, 0.2, 2.5)
+local v = Vector3.new(3, -1, 7)
+
+bench("a * b", function(n)
+	local c
+	for _ = 1, n do c = a * b end
+	return c
+end)
+
+bench("Inverse", function(n)
+	local c
+	for _ = 1, n do c = a:Inverse() end
+	return c
+end)
+
+bench("a * v", function(n)
+	local w
+	for _ = 1, n do w = a * v end
+	return w
+end)
+
+bench("PointToWorldSpace", function(n)
+	local w
+	for _ = 1, n do w = a:PointToWorldSpace(v) end
+	return w
+end)
+
+bench("PointToObjectSpace", function(n)
+	local w
+	for _ = 1, n do w = a:PointToObjectSpace(v) end
+	return w
+end)
+
+bench("Lerp", function(n)
+	local c
+	for i = 1, n do c = a:Lerp(b, (i % 100) / 100) end
+	return c
+end)
+
+print("[cframe] done")
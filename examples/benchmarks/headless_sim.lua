@@ -0,0 +1,63 @@
+--&serverscript
+-- Headless simulation benchmark
+-- A fixed CPU workload for the headless engine: looping tweens, Heartbeat listeners and
+-- waiting tasks. With the fixed-step clock every run simulates the same frames, so the
+-- engine's ms/frame summary can be compared between builds; each progress line also
+-- gives the wall time per frame and heap growth over its window.
+-- Run with: moon-engine --headless --clock fixed --frames 3600 --no-place --path examples/benchmarks/headless_sim.lua
+
+local Bench = require("./lib/bench")
+
+local RunService = game:GetService("RunService")
+local TweenService = game:GetService("TweenService")
+
+local PARTS, LISTENERS, TASKS = 500, 200, 200
+
+-- looping tweens
+for i = 1, PARTS do
+	local p = Instance.new("Part")
+	p.Name = "BenchPart" .. i
+	p.Position = Vector3.new(i % 25 * 4, 2, i // 25 * 4)
+	p.Parent = workspace
+
+	local info = TweenInfo.new(1 + i % 7 * 0.25, Enum.EasingStyle.Sine, Enum.EasingDirection.InOut, 1e6, true)
+	TweenService:Create(p, info, { Position = p.Position + Vector3.new(0, 10, 0) }):Play()
+end
+
+-- per-frame listeners doing a little math
+local acc = 0
+for i = 1, LISTENERS do
+	RunService.Heartbeat:Connect(function(dt)
+		local x = i * dt
+		for _ = 1, 20 do x = math.sin(x) + math.cos(x) end
+		acc += x
+	end)
+end
+
+-- tasks sleeping on a spread of intervals
+local wakes = 0
+for i = 1, TASKS do
+	task.spawn(function()
+		local interval = 0.05 + i % 10 * 0.01
+		while true do
+			task.wait(interval)
+			wakes += 1
+		end
+	end)
+end
+
+-- progress line every simulated 10 seconds
+local frames, simTime = 0, 0
+local windowFrames, stop = 0, Bench.start()
+RunService.Heartbeat:Connect(function(dt)
+	frames += 1
+	windowFrames += 1
+	simTime += dt
+	if simTime >= 10 then
+		simTime -= 10
+		local seconds, heapKB = stop()
+		print(string.format("[headless] frames=%d wakes=%d acc=%.3f  %.3f ms/frame, %d KB heap",
+			frames, wakes, acc, seconds * 1000 / windowFrames, heapKB))
+		windowFrames, stop = 0, Bench.start()
+	end
+end)
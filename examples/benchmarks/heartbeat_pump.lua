@@ -0,0 +1,42 @@
+--&serverscript
+-- RunService frame pump benchmark
+-- Measures what a frame costs with 0, 10 and 1000 empty Heartbeat listeners connected.
+-- With the fixed-step clock frames run back to back, so the time per frame is the
+-- engine's own overhead: the frame pump, the listener calls and the scheduler step.
+-- Run with: moon-engine --headless --clock fixed --frames 4000 --no-place --path examples/benchmarks/heartbeat_pump.lua
+
+local Bench = require("./lib/bench")
+
+local RunService = game:GetService("RunService")
+
+local FRAMES = 1000
+local COUNTS = { 0, 10, 1000 }
+
+local function measure(count)
+	local connections = table.create(count)
+	for i = 1, count do
+		connections[i] = RunService.Heartbeat:Connect(function(dt) end)
+	end
+
+	RunService.PostSimulation:Wait() -- start on a frame boundary
+	local stop = Bench.start()
+	for _ = 1, FRAMES do
+		RunService.PostSimulation:Wait()
+	end
+	local usPerFrame = stop() * 1e6 / FRAMES
+
+	for _, c in connections do
+		c:Disconnect()
+	end
+	return usPerFrame
+end
+
+local baseline
+for _, count in COUNTS do
+	local us = measure(count)
+	baseline = baseline or us
+	local perListener = count > 0 and string.format(", %.3f us per listener", (us - baseline) / count) or ""
+	print(string.format("[pump] %5d Heartbeat listeners: %8.2f us/frame%s", count, us, perListener))
+end
+
+print("[pump] done")
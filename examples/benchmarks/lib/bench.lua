@@ -0,0 +1,33 @@
+-- Timing helpers shared by the benchmarks in the folder above. It lives in lib/ so that
+-- --path on the benchmarks folder doesn't start it as a script; a benchmark loads it
+-- with: local Bench = require("./lib/bench")
+
+local Bench = {}
+
+-- Starts a stopwatch. The returned function gives the seconds and the KB of Lua heap
+-- growth since the start; for work that yields or spans frames.
+function Bench.start()
+	local heapBefore = gcinfo()
+	local start = os.clock()
+	return function()
+		return os.clock() - start, gcinfo() - heapBefore
+	end
+end
+
+-- Runs fn(warmup) first (1000 by default), then times fn(n). Returns the seconds per
+-- iteration and how many KB the Lua heap grew over the timed call.
+function Bench.time(n, fn, warmup)
+	fn(warmup or 1000)
+	local stop = Bench.start()
+	fn(n)
+	local seconds, heapKB = stop()
+	return seconds / n, heapKB
+end
+
+-- Times fn(n) and prints one "[tag] label  ns/op, heap" line
+function Bench.run(tag, label, n, fn)
+	local seconds, heapKB = Bench.time(n, fn)
+	print(string.format("[%s] %-18s %7.1f ns/op, %6d KB heap", tag, label, seconds * 1e9, heapKB))
+end
+
+return Bench
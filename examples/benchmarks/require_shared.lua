@@ -0,0 +1,66 @@
+--&serverscript
+-- Shared module benchmark
+-- Starts N scripts that all use the same utility library, once with the library pasted
+-- into every script and once through require() of a single ModuleScript, and reports
+-- the time spent compiling/starting them and the Lua heap they leave behind.
+-- Run with: moon-engine --path examples/benchmarks/require_shared.lua
+
+local Bench = require("./lib/bench")
+
+local SCRIPTS = 300
+local FUNCTIONS = 200
+
+-- a utility library of FUNCTIONS small functions
+local parts = { "local Util = {}" }
+for i = 1, FUNCTIONS do
+	parts[#parts + 1] = string.format(
+		"function Util.f%d(a, b) local s = 0 for k = 1, %d do s += (a * k + b) %% 7 end return s end", i, i % 9 + 1)
+end
+local LIBRARY = table.concat(parts, "\n")
+
+local holder = Instance.new("Folder")
+holder.Name = "RequireBench"
+holder.Parent = workspace
+
+local module = Instance.new("ModuleScript")
+module.Name = "Util"
+module.Source = LIBRARY .. "\nreturn Util"
+module.Parent = holder
+
+local BODY = "\nlocal x = Util.f1(1, 2) + Util.f%d(3, 4)\nwhile true do task.wait(1) end\n"
+
+local function runRound(label, makeSource)
+	local folder = Instance.new("Folder")
+	folder.Name = label
+	folder.Parent = holder
+
+	local stop = Bench.start()
+	for i = 1, SCRIPTS do
+		local s = Instance.new("Script")
+		s.Name = label .. i
+		s.Source = makeSource(i)
+		s.Parent = folder
+		s.Enabled = true -- compiles and schedules now
+	end
+	local compileMs = stop() * 1000
+
+	-- let every script run its first resume
+	task.wait(0.5)
+	local _, heapKB = stop()
+
+	print(string.format("[require] %-8s %d scripts: %7.1f ms to start, %8.0f KB heap", label, SCRIPTS, compileMs, heapKB))
+	folder:Destroy()
+	task.wait(0.25)
+end
+
+print(string.format("[require] library: %d functions, %d bytes", FUNCTIONS, #LIBRARY))
+
+runRound("inline", function(i)
+	return "--&serverscript\n" .. LIBRARY .. string.format(BODY, i % FUNCTIONS + 1)
+end)
+
+runRound("require", function(i)
+	return "--&serverscript\nlocal Util = require(workspace.RequireBench.Util)" .. string.format(BODY, i % FUNCTIONS + 1)
+end)
+
+print("[require] done")
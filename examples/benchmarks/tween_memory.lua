@@ -0,0 +1,42 @@
+--&serverscript
+-- Tween memory benchmark
+-- Creates 10,000 tweens that are never played or connected to, the common case for a
+-- Tween's Completed signal, and reports what they cost: creation time, Lua heap growth
+-- and the growth of this script's memory category (script.MemoryUsage). The signals'
+-- native storage is outside the Lua heap; an unconnected signal should own none.
+-- Run with: moon-engine --headless --no-place --path examples/benchmarks/tween_memory.lua
+
+local Bench = require("./lib/bench")
+
+local TweenService = game:GetService("TweenService")
+
+local TWEENS = 10000
+local PARTS = 100
+
+local parts = table.create(PARTS)
+for i = 1, PARTS do
+	local p = Instance.new("Part")
+	p.Name = "TweenMemoryPart" .. i
+	p.Parent = workspace
+	parts[i] = p
+end
+
+local info = TweenInfo.new(1)
+local goal = { Position = Vector3.new(0, 10, 0) }
+local tweens = table.create(TWEENS)
+
+local categoryBefore = script.MemoryUsage
+local stop = Bench.start()
+for i = 1, TWEENS do
+	tweens[i] = TweenService:Create(parts[i % PARTS + 1], info, goal)
+end
+local seconds, heapKB = stop()
+local categoryKB = script.MemoryUsage - categoryBefore
+
+print(string.format("[tween] %d tweens: %7.1f us each to create", TWEENS, seconds * 1e6 / TWEENS))
+print(string.format("[tween] Lua heap        %8d KB  (%5.0f bytes per tween)", heapKB, heapKB * 1024 / TWEENS))
+print(string.format("[tween] memory category %8.0f KB  (%5.0f bytes per tween)", categoryKB, categoryKB * 1024 / TWEENS))
+
+tweens = nil
+for _, p in parts do p:Destroy() end
+print("[tween] done")
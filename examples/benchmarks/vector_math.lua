@@ -0,0 +1,55 @@
+--&serverscript
+-- Vector3 math benchmark
+-- Runs the kind of vector math a Heartbeat handler does (constructors, arithmetic,
+-- Magnitude, Unit, Dot, Cross, Lerp) and reports the time per operation and the Lua
+-- heap it leaves behind. Vector3 is a native vector value, so the heap figure should be 0.
+-- Run with: moon-engine --headless --no-place --path examples/benchmarks/vector_math.lua
+
+local Bench = require("./lib/bench")
+
+local N = 1000000
+
+local function bench(label, fn)
+	Bench.run("vector", label, N, fn)
+end
+
+local a = Vector3.new(1, 2, 3)
+local b = Vector3.new(4, 5, 6)
+
+bench("new", function(n)
+	local v
+	for i = 1, n do v = Vector3.new(i, i, i) end
+	return v
+end)
+
+bench("arith", function(n)
+	local v = Vector3.zero
+	for _ = 1, n do v = (v + a) * 0.5 - b / 4 end
+	return v
+end)
+
+bench("Magnitude", function(n)
+	local s = 0
+	for _ = 1, n do s += a.Magnitude end
+	return s
+end)
+
+bench("Unit", function(n)
+	local v
+	for _ = 1, n do v = b.Unit end
+	return v
+end)
+
+bench("Dot/Cross", function(n)
+	local s = 0
+	for _ = 1, n do s += a:Cross(b):Dot(a) end
+	return s
+end)
+
+bench("Lerp", function(n)
+	local v = a
+	for _ = 1, n do v = v:Lerp(b, 0.01) end
+	return v
+end)
+
+print("[vector] done")
@@ -0,0 +1,171 @@
+--&serverscript
+-- CFrame exactness checks
+-- Pins the column layout and Lerp's slerp against the old row-major math: the 12-float
+-- pack round trip, every matrix entry against the R00..R22 it was built from, and the
+-- slerp endpoints, extrapolation, orthonormality and opposite-hemisphere cases. Raises
+-- on the first failure. Run with: moon-engine --headless --no-place --frames 1 --path examples/cframe_test.lua
+
+local EPS = 1e-5
+local checks = 0
+
+local function check(ok, fmt, ...)
+	checks += 1
+	if not ok then
+		error(string.format("[cframe_test] " .. fmt, ...), 2)
+	end
+end
+
+local function near(a, b, eps)
+	return math.abs(a - b) <= (eps or EPS)
+end
+
+local function checkVector(v, x, y, z, what, eps)
+	check(near(v.X, x, eps) and near(v.Y, y, eps) and near(v.Z, z, eps),
+		"%s: got (%g, %g, %g), want (%g, %g, %g)", what, v.X, v.Y, v.Z, x, y, z)
+end
+
+local function sameComponents(a, b, what)
+	local ca, cb = { a:GetComponents() }, { b:GetComponents() }
+	for k = 1, 12 do
+		check(ca[k] == cb[k], "%s: component %d is %.9g, want %.9g", what, k, cb[k], ca[k])
+	end
+end
+
+local samples = {
+	CFrame.new(),
+	CFrame.new(1, 2, 3),
+	CFrame.new(1.5, -2.25, 3.125) * CFrame.Angles(0.3, 1.1, -0.4),
+	CFrame.new(-40, 5, 9) * CFrame.Angles(-1.2, 0.2, 2.5),
+	CFrame.Angles(math.pi / 2, 0, 0),
+	CFrame.new(0.1, 0.2, 0.3) * CFrame.Angles(3, -3, 1e-4),
+}
+
+-- Pack round trip: 12 f32 in GetComponents order, bit-exact both ways
+do
+	local buf = buffer.create(#samples * 48)
+	for i, cf in samples do
+		CFrame.writeBuffer(buf, i - 1, cf)
+	end
+	for i, cf in samples do
+		sameComponents(cf, CFrame.readBuffer(buf, i - 1), "readBuffer(writeBuffer) #" .. i)
+		local c = { cf:GetComponents() }
+		for k = 1, 12 do
+			local f = buffer.readf32(buf, (i - 1) * 48 + (k - 1) * 4)
+			check(f == c[k], "packed float %d of #%d is %.9g, want %.9g", k, i, f, c[k])
+		end
+	end
+end
+
+-- Layout: r(row, col) against the old row-major R[9], where R00..R22 are the
+-- constructor arguments and the basis vectors are its columns
+do
+	local R = { 0.36, 0.48, -0.8, -0.8, 0.6, 0, 0.48, 0.64, 0.6 }
+	local cf = CFrame.new(4, 5, 6, table.unpack(R))
+	local c = { cf:GetComponents() }
+	check(c[1] == 4 and c[2] == 5 and c[3] == 6, "position changed on the way in")
+	for k = 1, 9 do
+		check(near(c[3 + k], R[k], 1e-7), "R%d%d is %g, want %g", (k - 1) // 3, (k - 1) % 3, c[3 + k], R[k])
+	end
+	checkVector(cf.XVector, R[1], R[4], R[7], "XVector")
+	checkVector(cf.YVector, R[2], R[5], R[8], "YVector")
+	checkVector(cf.ZVector, R[3], R[6], R[9], "ZVector")
+	checkVector(cf.LookVector, -R[3], -R[6], -R[9], "LookVector")
+
+	-- point transform as the old code wrote it: row k of R dotted with v, plus p
+	local v = Vector3.new(2, -3, 7)
+	checkVector(cf:PointToWorldSpace(v),
+		R[1] * 2 + R[2] * -3 + R[3] * 7 + 4,
+		R[4] * 2 + R[5] * -3 + R[6] * 7 + 5,
+		R[7] * 2 + R[8] * -3 + R[9] * 7 + 6, "PointToWorldSpace")
+	checkVector(cf:PointToObjectSpace(cf:PointToWorldSpace(v)), 2, -3, 7, "PointToObjectSpace round trip")
+
+	-- composition as the old code wrote it: C[i][j] = sum_k A[i][k] * B[k][j]
+	for _, a in samples do
+		for _, b in samples do
+			local A, B, C = { a:GetComponents() }, { b:GetComponents() }, { (a * b):GetComponents() }
+			for i = 0, 2 do
+				for j = 0, 2 do
+					local want = 0
+					for k = 0, 2 do want += A[4 + i * 3 + k] * B[4 + k * 3 + j] end
+					check(near(C[4 + i * 3 + j], want), "(a * b) R%d%d is %g, want %g", i, j, C[4 + i * 3 + j], want)
+				end
+			end
+		end
+	end
+end
+
+local function checkOrthonormal(cf, what)
+	local x, y, z = cf.XVector, cf.YVector, cf.ZVector
+	check(near(x.Magnitude, 1) and near(y.Magnitude, 1) and near(z.Magnitude, 1), "%s: basis not unit length", what)
+	check(near(x:Dot(y), 0) and near(y:Dot(z), 0) and near(z:Dot(x), 0), "%s: basis not orthogonal", what)
+	check(near(x:Cross(y):Dot(z), 1), "%s: basis not right-handed", what)
+end
+
+-- Slerp: exact endpoints, orthonormal in between, linear position
+do
+	for i, a in samples do
+		for j, b in samples do
+			local what = string.format("#%d:Lerp(#%d", i, j)
+			sameComponents(a, a:Lerp(b, 0), what .. ", 0)")
+			sameComponents(b, a:Lerp(b, 1), what .. ", 1)")
+			for _, t in { 0.25, 0.5, 0.77 } do
+				local m = a:Lerp(b, t)
+				checkOrthonormal(m, string.format("%s, %g)", what, t))
+				local p = a.Position:Lerp(b.Position, t)
+				checkVector(m.Position, p.X, p.Y, p.Z, string.format("%s, %g) position", what, t))
+			end
+		end
+	end
+
+	-- Constant angular speed: each quarter covers a quarter of the angle
+	local a, b = CFrame.Angles(0, 0.2, 0), CFrame.Angles(0, 1.8, 0)
+	for _, t in { 0.25, 0.5, 0.75 } do
+		local want = CFrame.Angles(0, 0.2 + 1.6 * t, 0)
+		checkVector(a:Lerp(b, t).XVector, want.XVector.X, want.XVector.Y, want.XVector.Z, "uniform slerp at " .. t)
+	end
+
+	-- Outside [0, 1] Lerp extrapolates: the rotation keeps turning at the same rate
+	-- and the position keeps moving along the same line
+	for _, t in { -1, -0.5, 1.5, 2 } do
+		local m = CFrame.new(1, 2, 3) * a
+		local e = m:Lerp(CFrame.new(5, 2, -1) * b, t)
+		local want = CFrame.Angles(0, 0.2 + 1.6 * t, 0)
+		checkVector(e.XVector, want.XVector.X, want.XVector.Y, want.XVector.Z, "extrapolated slerp at " .. t)
+		checkOrthonormal(e, "extrapolated slerp at " .. t)
+		checkVector(e.Position, 1 + 4 * t, 2, 3 - 4 * t, "extrapolated position at " .. t)
+	end
+
+	-- 3 and -3 rad about Y are 0.28 rad apart through pi, not 6 rad through 0: the
+	-- quaternions land in opposite hemispheres and the short arc must still be taken
+	local half = CFrame.Angles(0, 3, 0):Lerp(CFrame.Angles(0, -3, 0), 0.5)
+	checkVector(half.XVector, -1, 0, 0, "short arc through pi")
+	checkOrthonormal(half, "short arc through pi")
+
+	-- Same for 0 and 2pi - 0.2: the midpoint is -0.1, not pi - 0.1
+	local wrap = CFrame.new():Lerp(CFrame.Angles(0, 2 * math.pi - 0.2, 0), 0.5)
+	local want = CFrame.Angles(0, -0.1, 0)
+	checkVector(wrap.XVector, want.XVector.X, want.XVector.Y, want.XVector.Z, "short arc across 0")
+
+	-- Every pair of yaws: the midpoint is halfway along the shorter way round, whichever
+	-- signs the two quaternions come out of the matrices with
+	for ya = -3, 3, 0.25 do
+		for yb = -3, 3, 0.25 do
+			local diff = (yb - ya + math.pi) % (2 * math.pi) - math.pi
+			if math.abs(diff) < math.pi - 0.1 then
+				local mid = CFrame.Angles(0, ya, 0):Lerp(CFrame.Angles(0, yb, 0), 0.5)
+				local want = CFrame.Angles(0, ya + diff / 2, 0)
+				checkVector(mid.XVector, want.XVector.X, want.XVector.Y, want.XVector.Z,
+					string.format("short arc from %g to %g", ya, yb))
+			end
+		end
+	end
+
+	-- Exactly opposite (pi apart): either way round is fine, but it must stay a
+	-- rotation about the shared axis
+	local flip = CFrame.new():Lerp(CFrame.Angles(0, math.pi, 0), 0.5)
+	checkOrthonormal(flip, "half of a pi turn")
+	checkVector(flip.YVector, 0, 1, 0, "half of a pi turn keeps its axis")
+	check(near(math.abs(flip.XVector.Z), 1), "half of a pi turn is a quarter turn")
+end
+
+print(string.format("[cframe_test] all %d checks passed", checks))
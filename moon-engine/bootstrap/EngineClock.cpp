@@ -0,0 +1,55 @@
+// ================== bootstrap/EngineClock.cpp ==================
+#include "bootstrap/EngineClock.h"
+
+#include <chrono>
+
+static std::unique_ptr<EngineClock>& ActiveClock() {
+    static std::unique_ptr<EngineClock> clock = std::make_unique<RealClock>();
+    return clock;
+}
+
+EngineClock& EngineClock::Get() {
+    return *ActiveClock();
+}
+
+void EngineClock::Set(std::unique_ptr<EngineClock> clock) {
+    // only swapped during startup, before anything has scheduled against the old clock
+    if (clock) ActiveClock() = std::move(clock);
+}
+
+double EngineClock::Wall() {
+    using namespace std::chrono;
+    static const steady_clock::time_point start = steady_clock::now();
+    return duration<double>(steady_clock::now() - start).count();
+}
+
+// ---- RealClock
+
+RealClock::RealClock() : origin(Wall()), last(origin) {}
+
+double RealClock::Now() const {
+    return Wall() - origin;
+}
+
+double RealClock::Tick() {
+    const double w  = Wall();
+    const double dt = w - last;
+    last = w;
+    return dt;
+}
+
+// ---- AcceleratedClock
+
+AcceleratedClock::AcceleratedClock(double scale)
+    : scale(scale > 0.0 ? scale : 1.0), origin(Wall()), last(origin) {}
+
+double AcceleratedClock::Now() const {
+    return (Wall() - origin) * scale;
+}
+
+double AcceleratedClock::Tick() {
+    const double w  = Wall();
+    const double dt = (w - last) * scale;
+    last = w;
+    return dt;
+}
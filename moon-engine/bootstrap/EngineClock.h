@@ -0,0 +1,68 @@
+// ================== bootstrap/EngineClock.h ==================
+#pragma once
+
+#include <memory>
+
+// Simulation time source. Everything that schedules against "now" (wait, task.delay,
+// RunService step arguments, tween dt) reads the active clock instead of raylib's
+// GetTime, so a headless run can use a fixed-step or accelerated clock.
+class EngineClock {
+public:
+    virtual ~EngineClock() = default;
+
+    // Simulation seconds since the clock was created.
+    virtual double Now() const = 0;
+
+    // Advances to the next frame and returns its dt.
+    virtual double Tick() = 0;
+
+    virtual const char* Name() const = 0;
+
+    // Active clock (a RealClock until Set is called).
+    static EngineClock& Get();
+    static void Set(std::unique_ptr<EngineClock> clock);
+
+    // Monotonic wall seconds, for budgets and profiling that must ignore the clock mode.
+    static double Wall();
+};
+
+// Follows the wall clock.
+class RealClock : public EngineClock {
+public:
+    RealClock();
+    double Now() const override;
+    double Tick() override;
+    const char* Name() const override { return "real"; }
+
+private:
+    double origin = 0.0;
+    double last   = 0.0;
+};
+
+// Advances by exactly 'step' seconds per frame regardless of how long the frame took.
+// Runs are reproducible and go as fast as the CPU allows.
+class FixedStepClock : public EngineClock {
+public:
+    explicit FixedStepClock(double step = 1.0 / 60.0) : step(step) {}
+    double Now() const override { return t; }
+    double Tick() override { t += step; return step; }
+    const char* Name() const override { return "fixed"; }
+
+private:
+    double step;
+    double t = 0.0;
+};
+
+// Wall clock scaled by 'scale' (2 = twice as fast as real time).
+class AcceleratedClock : public EngineClock {
+public:
+    explicit AcceleratedClock(double scale);
+    double Now() const override;
+    double Tick() override;
+    const char* Name() const override { return "accelerated"; }
+
+private:
+    double scale;
+    double origin = 0.0;
+    double last   = 0.0;
+};
@@ -81,12 +81,17 @@ void Game::Shutdown() {
     }
 
     luaScheduler.reset();
+
+    // ~Service erases itself from the registry, so the services must not die
+    // inside the registry's own destructor at exit.
+    auto services = std::move(Service::registry);
+    Service::registry.clear();
+    services.clear();
     LogBoth("Game::Shutdown end");
 }
 
 static std::shared_ptr<Instance>* checkInstanceUD(lua_State* L, int idx) {
-    return static_cast<std::shared_ptr<Instance>*>(
-        luaL_checkudata(L, idx, "Librebox.Instance"));
+    return Lua_CheckInstance(L, idx);
 }
 
 // game:GetService(name)
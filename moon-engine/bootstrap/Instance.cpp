@@ -1,4 +1,6 @@
 #include "bootstrap/Instance.h"
+#include "bootstrap/Game.h"
+#include "bootstrap/signals/Signal.h"
 #include "core/logging/Logging.h"
 #include <algorithm>
 #include <unordered_map>
@@ -17,6 +19,7 @@ static const char* ToClassName(InstanceClass c) {
         case InstanceClass::Model:       return "Model";
         case InstanceClass::Script:      return "Script";
         case InstanceClass::LocalScript: return "LocalScript";
+        case InstanceClass::ModuleScript: return "ModuleScript";
         case InstanceClass::Folder:      return "Folder";
         case InstanceClass::Camera:      return "Camera";
         case InstanceClass::Sky:         return "Sky";
@@ -24,6 +27,7 @@ static const char* ToClassName(InstanceClass c) {
         case InstanceClass::UserInputService:    return "UserInputService";
         case InstanceClass::TweenService:    return "TweenService";
         case InstanceClass::Lighting:    return "Lighting";
+        case InstanceClass::Actor:       return "Actor";
         default:                         return "Unknown";
     }
 }
@@ -40,18 +44,41 @@ std::optional<Attribute> Instance::GetAttribute(const std::string& name) const {
     return it->second;
 }
 
-// -------- tiny signal system --------
-size_t Instance::OnChildAdded(CB cb){ auto id=nextId++; childAdded_[id]=std::move(cb); return id; }
-size_t Instance::OnChildRemoved(CB cb){ auto id=nextId++; childRemoved_[id]=std::move(cb); return id; }
-size_t Instance::OnDescendantAdded(CB cb){ auto id=nextId++; descAdded_[id]=std::move(cb); return id; }
-size_t Instance::OnDescendantRemoved(CB cb){ auto id=nextId++; descRemoved_[id]=std::move(cb); return id; }
+// -------- signals --------
+std::shared_ptr<RTScriptSignal> Instance::GetEvent(Event e) {
+    LuaScheduler* sched = (g_game && g_game->luaScheduler) ? g_game->luaScheduler.get() : nullptr;
+    auto& sig = events.sig[size_t(e)];
+    if (!sig) {
+        static const char* const names[] = { "Instance.ChildAdded", "Instance.ChildRemoved",
+                                             "Instance.DescendantAdded", "Instance.DescendantRemoving" };
+        sig = std::make_shared<RTScriptSignal>(sched);
+        sig->name = names[size_t(e)];
+        if (!Alive) sig->Close();
+    } else if (sched) {
+        sig->AttachScheduler(sched);
+    }
+    return sig;
+}
+
+size_t Instance::connectEvent(Event e, CB cb) {
+    return GetEvent(e)->ConnectNative<std::shared_ptr<Instance>>(std::move(cb));
+}
+size_t Instance::OnChildAdded(CB cb){ return connectEvent(Event::ChildAdded, std::move(cb)); }
+size_t Instance::OnChildRemoved(CB cb){ return connectEvent(Event::ChildRemoved, std::move(cb)); }
+size_t Instance::OnDescendantAdded(CB cb){ return connectEvent(Event::DescendantAdded, std::move(cb)); }
+size_t Instance::OnDescendantRemoved(CB cb){ return connectEvent(Event::DescendantRemoving, std::move(cb)); }
 void   Instance::Disconnect(size_t id){
-    childAdded_.erase(id); childRemoved_.erase(id); descAdded_.erase(id); descRemoved_.erase(id);
+    for (auto& sig : events.sig) if (sig) sig->Disconnect(id);
+}
+
+// Nothing to do for the (common) instance nobody listens to
+void Instance::fireEvent(Event e, const std::shared_ptr<Instance>& c) {
+    if (auto& sig = events.sig[size_t(e)]) sig->Emit(c);
+}
+
+void Instance::closeEvents() {
+    for (auto& sig : events.sig) if (sig) sig->Close();
 }
-void Instance::fireChildAdded(const std::shared_ptr<Instance>& c){ for(auto& kv:childAdded_) kv.second(c); }
-void Instance::fireChildRemoved(const std::shared_ptr<Instance>& c){ for(auto& kv:childRemoved_) kv.second(c); }
-void Instance::fireDescendantAdded(const std::shared_ptr<Instance>& c){ for(auto& kv:descAdded_) kv.second(c); }
-void Instance::fireDescendantRemoved(const std::shared_ptr<Instance>& c){ for(auto& kv:descRemoved_) kv.second(c); }
 
 // helper: apply f to node and all descendants
 static void forEachDesc(const std::shared_ptr<Instance>& n,
@@ -77,10 +104,10 @@ void Instance::SetParent(const std::shared_ptr<Instance>& parent) {
         if (it != old->ChildrenByName.end() && it->second.get() == this) old->ChildrenByName.erase(it);
 
         // direct child removed
-        old->fireChildRemoved(self);
+        old->fireEvent(Event::ChildRemoved, self);
         // subtree: notify all ancestors of old
         for (auto a = old; a; a = a->Parent.lock()) {
-            forEachDesc(self, [&](const std::shared_ptr<Instance>& d){ a->fireDescendantRemoved(d); });
+            forEachDesc(self, [&](const std::shared_ptr<Instance>& d){ a->fireEvent(Event::DescendantRemoving, d); });
         }
     }
 
@@ -92,10 +119,10 @@ void Instance::SetParent(const std::shared_ptr<Instance>& parent) {
         parent->ChildrenByName[Name] = self;
 
         // direct child added
-        parent->fireChildAdded(self);
+        parent->fireEvent(Event::ChildAdded, self);
         // subtree: notify all ancestors of new
         for (auto a = parent; a; a = a->Parent.lock()) {
-            forEachDesc(self, [&](const std::shared_ptr<Instance>& d){ a->fireDescendantAdded(d); });
+            forEachDesc(self, [&](const std::shared_ptr<Instance>& d){ a->fireEvent(Event::DescendantAdded, d); });
         }
     }
 }
@@ -114,9 +141,9 @@ void Instance::Destroy() {
         auto it = p->ChildrenByName.find(Name);
         if (it != p->ChildrenByName.end() && it->second.get() == this) p->ChildrenByName.erase(it);
 
-        p->fireChildRemoved(self);
+        p->fireEvent(Event::ChildRemoved, self);
         for (auto a = p; a; a = a->Parent.lock()) {
-            forEachDesc(self, [&](const std::shared_ptr<Instance>& d){ a->fireDescendantRemoved(d); });
+            forEachDesc(self, [&](const std::shared_ptr<Instance>& d){ a->fireEvent(Event::DescendantRemoving, d); });
         }
     }
     Parent.reset();
@@ -126,6 +153,9 @@ void Instance::Destroy() {
     Children.clear();
     ChildrenByName.clear();
     Attributes.clear();
+
+    // a destroyed instance's connections are all dropped
+    closeEvents();
 }
 
 void Instance::LegacyFunctionRemove() {
@@ -156,11 +186,7 @@ std::shared_ptr<Instance> Instance::Clone() const {
         dst->Parent.reset();
         dst->Children.clear();
         dst->ChildrenByName.clear();
-        dst->childAdded_.clear();
-        dst->childRemoved_.clear();
-        dst->descAdded_.clear();
-        dst->descRemoved_.clear();
-        dst->nextId = 1;
+        // (event listeners are never copied, see EventSlots)
 
         // Reapply canonical base values
         dst->Name       = src->Name;
@@ -228,6 +254,9 @@ bool Instance::IsA(const std::string& className) const {
         case InstanceClass::Script:
             if (className == "BaseScript" || className == "LuaSourceContainer") return true;
             break;
+        case InstanceClass::ModuleScript:
+            if (className == "LuaSourceContainer") return true;
+            break;
         case InstanceClass::Game:
             if (className == "DataModel") return true; // Roblox alias
             break;
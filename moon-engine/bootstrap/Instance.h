@@ -14,6 +14,8 @@
 
 // Forward declare Lua to avoid coupling headers to Lua includes
 struct lua_State;
+struct RTScriptSignal;
+class LuaScheduler;
 
 enum class InstanceClass {
     Game,
@@ -23,6 +25,7 @@ enum class InstanceClass {
     Model,
     Script,
     LocalScript,
+    ModuleScript,
     Folder,
     Camera,
     Sky,
@@ -31,6 +34,7 @@ enum class InstanceClass {
     UserInputService,
     LogService,
     TweenService,
+    Actor,
     Unknown
 };
 using Attribute = std::variant<bool,double,std::string,::Vector3,::Color>;
@@ -86,6 +90,13 @@ struct Instance : std::enable_shared_from_this<Instance> {
     const std::unordered_map<std::string, Attribute>& GetAttributes() const { return Attributes; }
 
     // -------- signals --------
+    // ChildAdded, ChildRemoved, DescendantAdded and DescendantRemoving are RTScriptSignals,
+    // made on first use: scripts reach them as properties, engine code through the On*
+    // helpers below (native listeners on the same signal).
+    enum class Event { ChildAdded, ChildRemoved, DescendantAdded, DescendantRemoving, Count };
+    // Bound to the game's main VM, the only one Lua listeners can connect from
+    std::shared_ptr<RTScriptSignal> GetEvent(Event e);
+
     using CB = std::function<void(const std::shared_ptr<Instance>&)>;
     size_t OnChildAdded(CB cb);
     size_t OnChildRemoved(CB cb);
@@ -162,13 +173,18 @@ public:
     };
 
 private:
-    size_t nextId{1};
-    std::unordered_map<size_t, CB> childAdded_, childRemoved_, descAdded_, descRemoved_;
+    // Not copied by the Registrar copier: a clone starts with no listeners
+    struct EventSlots {
+        std::shared_ptr<RTScriptSignal> sig[size_t(Event::Count)];
+        EventSlots() = default;
+        EventSlots(const EventSlots&) {}
+        EventSlots& operator=(const EventSlots&) { return *this; }
+    };
+    EventSlots events;
 
-    void fireChildAdded(const std::shared_ptr<Instance>& c);
-    void fireChildRemoved(const std::shared_ptr<Instance>& c);
-    void fireDescendantAdded(const std::shared_ptr<Instance>& c);
-    void fireDescendantRemoved(const std::shared_ptr<Instance>& c);
+    size_t connectEvent(Event e, CB cb);
+    void   fireEvent(Event e, const std::shared_ptr<Instance>& c);
+    void   closeEvents();
 
     static std::unordered_map<std::string, TypeInfo>& types();
 };
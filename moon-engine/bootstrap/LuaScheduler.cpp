@@ -1,16 +1,17 @@
 // ================== bootstrap/LuaScheduler.cpp ==================
 #include "bootstrap/LuaScheduler.h"
+#include "bootstrap/signals/Signal.h"
 #include "bootstrap/instances/BaseScript.h"
 #include "bootstrap/instances/Workspace.h"
 #include "bootstrap/Game.h"
 #include "core/logging/Logging.h"
+#include "core/datatypes/LuaDatatypes.h"
 
 #include <cstdlib>
 #include <limits>
 #include <algorithm>
 
-// Raylib time
-#include <raylib.h>
+#include "bootstrap/EngineClock.h"
 
 // Luau
 #include "lua.h"
@@ -21,8 +22,6 @@
 extern std::shared_ptr<Game> g_game;
 
 LuaScheduler::LuaScheduler()
-    : sleepingByTime(TimeCmp{&state})
-    , sleepingTasks(TaskTimeCmp{&tasks})
 {
     LOGI("LuaScheduler: Initializing...");
     L_main = luaL_newstate();
@@ -35,6 +34,12 @@ LuaScheduler::LuaScheduler()
     lua_gc(L_main, LUA_GCSETGOAL,     200);
     lua_gc(L_main, LUA_GCSETSTEPMUL,  200);
     lua_gc(L_main, LUA_GCSETSTEPSIZE, 128);
+
+    // Watchdog: the VM calls this at loop back-edges and function calls
+    lua_Callbacks* cb = lua_callbacks(L_main);
+    cb->userdata  = this;
+    cb->interrupt = &LuaScheduler::OnInterrupt;
+    cb->useratom  = &lb::atom_for;  // integer keys for the hot __index paths
 }
 
 LuaScheduler::~LuaScheduler() {
@@ -43,10 +48,15 @@ LuaScheduler::~LuaScheduler() {
     while (!sleepingTasks.empty()) sleepingTasks.pop();
     ready.clear();
     nextFrameQ.clear();
+    parallelQ.clear();
     readyTasks.clear();
     nextFrameTasks.clear();
-    // Unref any remaining task threads
+    parallelTasks.clear();
+    deferredTasks.clear();
+    // Unref any remaining task and pooled threads
     if (L_main) {
+        for (auto& t : threadPool) lua_unref(L_main, t.ref);
+        threadPool.clear();
         for (auto& kv : tasks) {
             if (kv.second.registryRef != LUA_NOREF) {
                 lua_unref(L_main, kv.second.registryRef);
@@ -72,6 +82,139 @@ lua_State* LuaScheduler::GetScriptThread(BaseScript* s) {
     auto it = state.find(s); return it==state.end() ? nullptr : it->second.co;
 }
 
+// ======= Watchdog =======
+
+void LuaScheduler::SetScriptLimits(BaseScript* s, const ScriptLimits& limits) {
+    auto it = state.find(s); if (it == state.end()) return;
+    it->second.limits = limits;
+    if (it->second.memcat) memcatLimits[it->second.memcat] = limits; // its tasks follow
+}
+
+void LuaScheduler::ArmWatchdog(const ScriptLimits& limits, int memcat, lua_State* co) {
+    watchdog.armed    = limits.maxResumeSeconds > 0.0;
+    watchdog.thread   = co;
+    watchdog.tripped  = false;
+    watchdog.budget   = limits.maxResumeSeconds;
+    watchdog.action   = limits.onTimeout;
+    watchdog.deadline = watchdog.armed ? lua_clock() + limits.maxResumeSeconds : 0.0;
+    watchdog.memcat   = memcat;
+    watchdog.memHard  = memcat ? memcatLimits[memcat].memHardBytes : 0;
+}
+
+bool LuaScheduler::DisarmWatchdog() {
+    watchdog.armed   = false;
+    watchdog.thread  = nullptr;
+    watchdog.memHard = 0;
+    return watchdog.tripped;
+}
+
+void LuaScheduler::OnInterrupt(lua_State* L, int gc) {
+    if (gc >= 0) return; // GC step notification, not a safepoint
+    auto* self = static_cast<LuaScheduler*>(lua_callbacks(L)->userdata);
+    if (!self) return;
+    auto& wd = self->watchdog;
+
+    // chunk names are "@<script name>", so short_src names the offender
+    auto where = [L](int& line) {
+        lua_Debug ar{};
+        line = 0;
+        if (!lua_getinfo(L, 0, "sl", &ar)) return std::string("?");
+        line = ar.currentline;
+        return std::string(ar.short_src);
+    };
+
+    // Hard memory limit for the running script's category. Checked here rather than
+    // in the allocator: a failed allocation raises wherever it happens, including
+    // inside engine code that pushes values for the script, which can't unwind. Like
+    // the time budget it keeps firing until the resume returns or memory drops.
+    if (wd.memHard && lua_totalbytes(L, wd.memcat) > wd.memHard) {
+        const size_t used = lua_totalbytes(L, wd.memcat);
+        int line;
+        const std::string name = where(line);
+        lua_pushfstring(L, "Script '%s' exceeded its memory limit (%d KB used, limit %d KB) (line %d)",
+                        name.c_str(), int(used / 1024), int(self->memcatLimits[wd.memcat].memHardBytes / 1024), line);
+        lua_error(L);
+    }
+
+    if (!wd.armed) return;
+    if (lua_clock() < wd.deadline) return;
+
+    // Stays armed until the resume returns: a pcall around the loop catches the
+    // error, so every later interrupt trips again
+    wd.tripped = true;
+
+    int line;
+    const std::string name = where(line);
+    const double ms = wd.budget * 1000.0;
+
+    // Only the thread the scheduler resumed can be suspended: a yield from a coroutine the
+    // script resumed itself would just return to the script. Yielding also only works
+    // outside metamethods / C calls. Anything else gets the error.
+    if (wd.action == TimeoutAction::Suspend && L == wd.thread && lua_isyieldable(L)) {
+        LOGW("Watchdog: script '%s' ran past %.0f ms (line %d), suspending until next frame", name.c_str(), ms, line);
+        lua_yield(L, 0);
+        return;
+    }
+
+    lua_pushfstring(L, "Script '%s' exceeded its %.0f ms execution budget (line %d)", name.c_str(), ms, line);
+    lua_error(L);
+}
+
+// Reads "--&timeout=<ms>" / "--&ontimeout=error|suspend" from the script header
+static void ParseLimitDirectives(const std::string& header, LuaScheduler::ScriptLimits& limits) {
+    size_t p = header.find("--&timeout=");
+    if (p != std::string::npos) {
+        limits.maxResumeSeconds = std::atof(header.c_str() + p + 11) / 1000.0;
+    }
+    p = header.find("--&ontimeout=");
+    if (p != std::string::npos) {
+        const std::string v = header.substr(p + 13, 7);
+        if (v == "suspend") limits.onTimeout = LuaScheduler::TimeoutAction::Suspend;
+        else if (v.rfind("error", 0) == 0) limits.onTimeout = LuaScheduler::TimeoutAction::Error;
+    }
+    p = header.find("--&memwarn=");
+    if (p != std::string::npos) {
+        limits.memSoftBytes = size_t(std::atof(header.c_str() + p + 11) * 1024.0);
+    }
+    p = header.find("--&memlimit=");
+    if (p != std::string::npos) {
+        limits.memHardBytes = size_t(std::atof(header.c_str() + p + 12) * 1024.0);
+    }
+}
+
+// ======= Memory accounting =======
+
+int LuaScheduler::AllocMemCategory() {
+    if (nextMemcat < LUA_MEMORY_CATEGORIES) return nextMemcat++;
+
+    // all handed out: reuse a stopped script's category once it's been fully collected
+    for (size_t i = 0; i < retiredMemcats.size(); ++i) {
+        const int cat = retiredMemcats[i];
+        if (lua_totalbytes(L_main, cat) == 0) {
+            retiredMemcats[i] = retiredMemcats.back();
+            retiredMemcats.pop_back();
+            return cat;
+        }
+    }
+    return 0; // shared category, untracked
+}
+
+int LuaScheduler::MemCategoryOf(lua_State* L) const {
+    if (!L) return 0;
+    if (auto* s = static_cast<BaseScript*>(lua_getthreaddata(L))) {
+        auto it = state.find(s);
+        return it == state.end() ? 0 : it->second.memcat;
+    }
+    auto it = tasks.find(L);
+    return it == tasks.end() ? 0 : it->second.memcat;
+}
+
+size_t LuaScheduler::GetScriptMemory(BaseScript* s) const {
+    auto it = state.find(s);
+    if (!L_main || it == state.end() || it->second.memcat == 0) return 0;
+    return lua_totalbytes(L_main, it->second.memcat);
+}
+
 void LuaScheduler::SetWaitEvent(BaseScript* s){
     auto it = state.find(s); if (it==state.end()) return;
     auto& st = it->second;
@@ -95,7 +238,7 @@ void LuaScheduler::ResumeScriptNextFrame(BaseScript* s, int argc){
     st.nextFrame  = true;
     st.pendingArgc = argc;
     st.hasPending = true;
-    nextFrameQ.push_back(st.co ? std::static_pointer_cast<BaseScript>(s->shared_from_this()) : nullptr);
+    nextFrameQ.push_back(ScriptEntry{std::static_pointer_cast<BaseScript>(s->shared_from_this()), st.epoch});
 }
 
 void LuaScheduler::WakeTaskNextFrame(lua_State* co, int argc){
@@ -105,13 +248,64 @@ void LuaScheduler::WakeTaskNextFrame(lua_State* co, int argc){
     st.nextFrame   = true;
     st.pendingArgc = argc;
     st.hasPending  = true; 
-    nextFrameTasks.push_back(co);
+    nextFrameTasks.push_back(TaskEntry{co, st.epoch});
+}
+
+// ======= Epochs / cancellation =======
+
+LuaScheduler::ScriptState* LuaScheduler::FindScript(BaseScript* s, uint32_t epoch) {
+    auto it = state.find(s);
+    return (it != state.end() && it->second.epoch == epoch) ? &it->second : nullptr;
+}
+
+LuaScheduler::TaskState* LuaScheduler::FindTask(lua_State* co, uint32_t epoch) {
+    auto it = tasks.find(co);
+    return (it != tasks.end() && it->second.epoch == epoch) ? &it->second : nullptr;
+}
+
+uint32_t LuaScheduler::ScriptEpoch(BaseScript* s) const {
+    auto it = state.find(s);
+    return it == state.end() ? 0 : it->second.epoch;
+}
+
+uint32_t LuaScheduler::TaskEpoch(lua_State* co) const {
+    auto it = tasks.find(co);
+    return it == tasks.end() ? 0 : it->second.epoch;
+}
+
+bool LuaScheduler::CancelThread(lua_State* co) {
+    if (!L_main || !co) return false;
+
+    // a thread that is running (or resumed something that is) unwinds by itself
+    const int cs = lua_costatus(L_main, co);
+    const bool active = cs == LUA_CORUN || cs == LUA_CONOR;
+
+    auto it = tasks.find(co);
+    if (it != tasks.end()) {
+        const int ref = it->second.registryRef;
+        tasks.erase(it); // queued entries for this epoch are now stale
+        if (!active) lua_resetthread(co);
+        UnrefLater(ref);
+        return true;
+    }
+
+    // a script's main thread: cancelling it stops the script
+    if (auto* s = static_cast<BaseScript*>(lua_getthreaddata(co))) {
+        auto sit = state.find(s);
+        if (sit != state.end() && sit->second.co == co) {
+            StopScript(s);
+            if (!active) lua_resetthread(co);
+            return true;
+        }
+    }
+    return false;
 }
 
 void LuaScheduler::AddScript(const std::shared_ptr<BaseScript>& script,
                              const std::string&                 name,
                              const std::string&                 source,
-                             const GlobalBinder&                binder)
+                             const GlobalBinder&                binder,
+                             std::string                        bytecode)
 {
     if (!L_main || !script) return;
 
@@ -148,49 +342,68 @@ void LuaScheduler::AddScript(const std::shared_ptr<BaseScript>& script,
         LOGE("LuaScheduler: lua_newthread failed for '%s'", name.c_str());
         return;
     }
+    const int threadRef = lua_ref(L_main, -1); // anchors the script thread until StopScript
+    lua_pop(L_main, 1);
 
     lua_setthreaddata(co, script.get());
     luaL_sandboxthread(co);
 
-    size_t bcSize = 0;
-    lua_CompileOptions opts{};
-    opts.optimizationLevel = 1;
-    opts.debugLevel        = 1;
+    // Everything the script allocates from here on is charged to its own category
+    const int memcat = AllocMemCategory();
+    if (memcat == 0) LOGW("LuaScheduler: out of memory categories, '%s' is untracked", name.c_str());
+    lua_setmemcat(co, memcat);
 
-    static const char* kMutable[] = {
-        "game", "workspace", "script", "shared", "plugin", nullptr
+    auto abandon = [&]() {
+        lua_unref(L_main, threadRef);
+        if (memcat) retiredMemcats.push_back(memcat);
     };
-    opts.mutableGlobals = kMutable;  // NULL-terminated
 
-    char* bytecode = luau_compile(source.c_str(), source.size(), &opts, &bcSize);
-    if (!bytecode || bcSize == 0) {
-        LOGE("Luau Compile Error for '%s'", name.c_str());
-        if (bytecode) free(bytecode);
-        return;
+    if (bytecode.empty()) {
+        size_t bcSize = 0;
+        lua_CompileOptions opts = CompileOptions();
+        char* compiled = luau_compile(source.c_str(), source.size(), &opts, &bcSize);
+        if (!compiled || bcSize == 0) {
+            LOGE("Luau Compile Error for '%s'", name.c_str());
+            if (compiled) free(compiled);
+            abandon();
+            return;
+        }
+        bytecode.assign(compiled, bcSize);
+        free(compiled);
     }
 
     const std::string chunkName = "@" + name;
-    if (luau_load(co, chunkName.c_str(), bytecode, bcSize, 0) != 0) {
+    if (luau_load(co, chunkName.c_str(), bytecode.data(), bytecode.size(), 0) != 0) {
         LOGE("Luau Load Error for '%s': %s", name.c_str(), lua_tostring(co, -1));
         lua_pop(co, 1);
-        free(bytecode);
+        abandon();
         return;
     }
-    free(bytecode);
 
     if (binder) binder(co, script.get());
 
+    ScriptLimits limits = defaultLimits;
+    ParseLimitDirectives(firstLines, limits);
+    if (memcat) memcatLimits[memcat] = limits;
+
     auto& st = state[script.get()];
+    st              = ScriptState{};
+    st.epoch        = NewEpoch();
     st.status       = Status::Running;
     st.co           = co;
+    st.threadRef    = threadRef;
     st.wakeTime     = 0.0;
     st.nextFrame    = false;
-    st.lastResumeTime = GetTime();
+    st.lastResumeTime = EngineClock::Get().Now();
     st.passDelta    = false;
     st.resumeDelta  = 0.0;
     st.firstResume  = true;
+    st.limits       = limits;
+    st.preempted    = false;
+    st.memcat       = memcat;
+    st.memWarned    = false;
 
-    ready.push_back(script);
+    ready.push_back(ScriptEntry{script, st.epoch});
 }
 
 void LuaScheduler::StopScript(BaseScript* s) {
@@ -198,12 +411,115 @@ void LuaScheduler::StopScript(BaseScript* s) {
 
     // Drop state so the coroutine will never be resumed again.
     auto it = state.find(s);
-    if (it != state.end()) state.erase(it);
+    if (it == state.end()) return;
+
+    const int memcat = it->second.memcat;
+    UnrefLater(it->second.threadRef);
+    // Any queue or timer entry still pointing at it goes stale with the state
+    state.erase(it);
+
+    if (memcat) {
+        // threads the script spawned and listeners it connected go with it
+        CancelTasksOf(memcat);
+        DisconnectOwnedBy(memcat);
+        memcatLimits[memcat] = ScriptLimits{};
+        retiredMemcats.push_back(memcat);
+    }
+}
 
-    // Purge from ready/nextFrame queues.
-    auto pred = [s](const std::shared_ptr<BaseScript>& sp){ return sp.get() == s; };
-    ready.erase(std::remove_if(ready.begin(), ready.end(), pred), ready.end());
-    nextFrameQ.erase(std::remove_if(nextFrameQ.begin(), nextFrameQ.end(), pred), nextFrameQ.end());
+void LuaScheduler::CancelTasksOf(int memcat) {
+    std::vector<lua_State*> owned;
+    for (const auto& kv : tasks) {
+        if (kv.second.memcat == memcat) owned.push_back(kv.first);
+    }
+    for (lua_State* co : owned) CancelThread(co);
+}
+
+// ======= Connection ownership =======
+
+void LuaScheduler::TrackConnection(int memcat, const std::weak_ptr<RTScriptSignal>& sig, size_t id) {
+    if (memcat < 0 || memcat >= LUA_MEMORY_CATEGORIES || id == 0) return;
+    auto& owned = connectionsByOwner[memcat];
+
+    // a script that keeps connecting and disconnecting doesn't grow the list forever
+    const size_t n = owned.size();
+    if (n >= 64 && (n & (n - 1)) == 0) {
+        owned.erase(std::remove_if(owned.begin(), owned.end(), [](const OwnedConnection& c) {
+                        auto s = c.sig.lock();
+                        return !s || !s->IsConnected(c.id);
+                    }),
+                    owned.end());
+    }
+    owned.push_back(OwnedConnection{sig, id});
+}
+
+void LuaScheduler::DisconnectOwnedBy(int memcat) {
+    if (memcat <= 0 || memcat >= LUA_MEMORY_CATEGORIES) return;
+    // moved out first: a Disconnect can run code that connects again
+    auto owned = std::move(connectionsByOwner[memcat]);
+    connectionsByOwner[memcat].clear();
+
+    size_t dropped = 0;
+    for (const auto& c : owned) {
+        auto s = c.sig.lock();
+        if (!s || !s->IsConnected(c.id)) continue;
+        s->Disconnect(c.id);
+        ++dropped;
+    }
+    if (dropped) LOGI("LuaScheduler: disconnected %zu listener(s) of a stopped script", dropped);
+}
+
+LuaScheduler::ConnectionReport LuaScheduler::GetConnectionReport() const {
+    std::array<bool, LUA_MEMORY_CATEGORIES> running{};
+    for (const auto& kv : state) running[kv.second.memcat] = true;
+
+    ConnectionReport r;
+    for (int cat = 0; cat < LUA_MEMORY_CATEGORIES; ++cat) {
+        for (const auto& c : connectionsByOwner[cat]) {
+            auto s = c.sig.lock();
+            if (!s || !s->IsConnected(c.id)) continue;
+            if (cat == 0)          ++r.unowned;
+            else if (running[cat]) ++r.owned;
+            else                   ++r.orphaned;
+        }
+    }
+    return r;
+}
+
+void LuaScheduler::LogOrphanedConnections() const {
+    std::array<bool, LUA_MEMORY_CATEGORIES> running{};
+    for (const auto& kv : state) running[kv.second.memcat] = true;
+
+    for (int cat = 1; cat < LUA_MEMORY_CATEGORIES; ++cat) {
+        if (running[cat]) continue;
+        // per signal, in the order they were first connected to
+        std::vector<std::pair<const RTScriptSignal*, size_t>> counts;
+        for (const auto& c : connectionsByOwner[cat]) {
+            auto s = c.sig.lock();
+            if (!s || !s->IsConnected(c.id)) continue;
+            auto it = std::find_if(counts.begin(), counts.end(), [&](const auto& p) { return p.first == s.get(); });
+            if (it == counts.end()) counts.emplace_back(s.get(), 1);
+            else ++it->second;
+        }
+        for (const auto& [sig, n] : counts) {
+            LOGW("Orphaned connections: %zu on %s (%p), owner category %d is no longer running",
+                 n, sig->name, (const void*)sig, cat);
+        }
+    }
+}
+
+std::string LuaScheduler::OwnerName(int memcat) const {
+    if (memcat == 0) return std::string();
+    for (const auto& kv : state) {
+        if (kv.second.memcat == memcat && kv.first) return kv.first->GetFullName();
+    }
+    return std::string();
+}
+
+// A thread that is mid-resume isn't reachable from any GC root but our ref, so refs of
+// stopped/cancelled threads are only dropped once the current Step is done with them.
+void LuaScheduler::UnrefLater(int ref) {
+    if (ref != LUA_NOREF) pendingUnrefs.push_back(ref);
 }
 
 void LuaScheduler::SetWaitAbs(BaseScript* s, double wakeTimeAbs) {
@@ -225,36 +541,83 @@ void LuaScheduler::SetWaitNextFrame(BaseScript* s) {
 
 // ======= Task API =======
 
-void LuaScheduler::ScheduleTaskNextFrame(lua_State* co, int registryRef, int initialArgc) {
+void LuaScheduler::ScheduleTaskNextFrame(lua_State* co, int registryRef, int initialArgc, int memcat) {
     if (!L_main || !co) return;
-    auto& st = tasks[co];
+    TaskState* slot = nullptr;
+    if (!spareTaskNode.empty()) {
+        spareTaskNode.key() = co;
+        auto ins = tasks.insert(std::move(spareTaskNode));
+        if (!ins.inserted) spareTaskNode = std::move(ins.node);
+        slot = &ins.position->second;
+    } else {
+        slot = &tasks[co];
+    }
+    auto& st = *slot;
+    st              = TaskState{};
+    st.epoch        = NewEpoch();
     st.status       = Status::Waiting;
     st.co           = co;
     st.registryRef  = registryRef;
     st.nextFrame    = true;
     st.wakeTime     = 0.0;
-    st.lastResumeTime = GetTime();
+    st.lastResumeTime = EngineClock::Get().Now();
     st.passDelta    = false;
     st.resumeDelta  = 0.0;
     st.firstResume  = true;
     st.pendingArgc  = initialArgc;
-    nextFrameTasks.push_back(co);
+    st.memcat       = memcat;
+    nextFrameTasks.push_back(TaskEntry{co, st.epoch});
 }
 
-void LuaScheduler::ScheduleTaskAt(lua_State* co, int registryRef, double wakeTimeAbs, int initialArgc) {
+void LuaScheduler::ScheduleTaskAt(lua_State* co, int registryRef, double wakeTimeAbs, int initialArgc, int memcat) {
     if (!L_main || !co) return;
-    auto& st = tasks[co];
+    TaskState* slot = nullptr;
+    if (!spareTaskNode.empty()) {
+        spareTaskNode.key() = co;
+        auto ins = tasks.insert(std::move(spareTaskNode));
+        if (!ins.inserted) spareTaskNode = std::move(ins.node);
+        slot = &ins.position->second;
+    } else {
+        slot = &tasks[co];
+    }
+    auto& st = *slot;
+    st              = TaskState{};
+    st.epoch        = NewEpoch();
     st.status       = Status::Waiting;
     st.co           = co;
     st.registryRef  = registryRef;
     st.nextFrame    = false;
     st.wakeTime     = wakeTimeAbs;
-    st.lastResumeTime = GetTime();
+    st.lastResumeTime = EngineClock::Get().Now();
     st.passDelta    = false;
     st.resumeDelta  = 0.0;
     st.firstResume  = true;
     st.pendingArgc  = initialArgc;
-    sleepingTasks.push(co);
+    st.memcat       = memcat;
+    sleepingTasks.push(Timed<TaskEntry>{wakeTimeAbs, TaskEntry{co, st.epoch}});
+}
+
+void LuaScheduler::ScheduleTaskDeferred(lua_State* co, int registryRef, int initialArgc, int memcat) {
+    if (!L_main || !co) return;
+    TaskState* slot = nullptr;
+    if (!spareTaskNode.empty()) {
+        spareTaskNode.key() = co;
+        auto ins = tasks.insert(std::move(spareTaskNode));
+        if (!ins.inserted) spareTaskNode = std::move(ins.node);
+        slot = &ins.position->second;
+    } else {
+        slot = &tasks[co];
+    }
+    auto& st = *slot;
+    st              = TaskState{};
+    st.epoch        = NewEpoch();
+    st.status       = Status::Running;
+    st.co           = co;
+    st.registryRef  = registryRef;
+    st.lastResumeTime = EngineClock::Get().Now();
+    st.pendingArgc  = initialArgc;
+    st.memcat       = memcat;
+    deferredTasks.push_back(TaskEntry{co, st.epoch});
 }
 
 void LuaScheduler::SetTaskWaitAbs(lua_State* co, double wakeTimeAbs) {
@@ -278,140 +641,98 @@ void LuaScheduler::SetTaskWaitNextFrame(lua_State* co) {
 void LuaScheduler::Step(double now, double /*dt*/) {
     if (!L_main) return;
     frameIndex++;
+    poolStats.creationsLastFrame = poolCreationsThisFrame;
+    poolCreationsThisFrame = 0;
 
-    lua_gc(L_main, LUA_GCSTEP, 200);
+    // Wake timed script sleepers (stale timers are dropped as they reach the top)
+    while (!sleepingByTime.empty() && sleepingByTime.top().wake <= now) {
+        const double wake = sleepingByTime.top().wake;
+        ScriptEntry  e    = sleepingByTime.top().entry;
+        sleepingByTime.pop();
 
-    // Wake timed script sleepers
-    while (!sleepingByTime.empty()) {
-        auto s = sleepingByTime.top();
-        auto it = state.find(s.get());
-        if (it == state.end()) { sleepingByTime.pop(); continue; }
-        auto& st = it->second;
+        auto sp = e.s.lock();
+        ScriptState* st = sp ? FindScript(sp.get(), e.epoch) : nullptr;
+        if (!st || st->status != Status::Waiting || st->nextFrame || st->wakeTime != wake) continue;
 
-        if (st.status != Status::Waiting || st.nextFrame) {
-            sleepingByTime.pop();
-            ready.push_back(s);
-            continue;
-        }
-        if (st.wakeTime > now) break;
-
-        sleepingByTime.pop();
-        st.status      = Status::Running;
-        st.nextFrame   = false;
-        st.passDelta   = true;
-        st.resumeDelta = now - st.lastResumeTime;
-        ready.push_back(std::move(s));
+        st->status      = Status::Running;
+        st->passDelta   = true;
+        st->resumeDelta = now - st->lastResumeTime;
+        ready.push_back(std::move(e));
     }
 
     // Wake timed TASK sleepers
-    while (!sleepingTasks.empty()) {
-        lua_State* co = sleepingTasks.top();
-        auto it = tasks.find(co);
-        if (it == tasks.end()) { sleepingTasks.pop(); continue; }
-        auto& st = it->second;
-
-        if (st.status != Status::Waiting || st.nextFrame) {
-            sleepingTasks.pop();
-            readyTasks.push_back(co);
-            continue;
-        }
-        if (st.wakeTime > now) break;
-
+    while (!sleepingTasks.empty() && sleepingTasks.top().wake <= now) {
+        const double wake = sleepingTasks.top().wake;
+        const TaskEntry e = sleepingTasks.top().entry;
         sleepingTasks.pop();
-        st.status      = Status::Running;
-        st.nextFrame   = false;
-        st.passDelta   = true;
-        st.resumeDelta = now - st.lastResumeTime;
-        readyTasks.push_back(co);
+
+        TaskState* st = FindTask(e.co, e.epoch);
+        if (!st || st->status != Status::Waiting || st->nextFrame || st->wakeTime != wake) continue;
+
+        st->status      = Status::Running;
+        st->passDelta   = true;
+        st->resumeDelta = now - st->lastResumeTime;
+        readyTasks.push_back(e);
     }
 
     // Move next-frame scripts
     if (!nextFrameQ.empty()) {
-        for (auto& s : nextFrameQ) {
-            auto it = state.find(s.get());
-            if (it == state.end()) continue;
-            auto& st = it->second;
-            st.status      = Status::Running;
-            st.nextFrame   = false;
-            st.passDelta   = true;
-            st.resumeDelta = now - st.lastResumeTime;
-            ready.push_back(std::move(s));
+        for (auto& e : nextFrameQ) {
+            auto sp = e.s.lock();
+            ScriptState* st = sp ? FindScript(sp.get(), e.epoch) : nullptr;
+            if (!st) continue;
+            st->status      = Status::Running;
+            st->nextFrame   = false;
+            st->passDelta   = true;
+            st->resumeDelta = now - st->lastResumeTime;
+            ready.push_back(std::move(e));
         }
         nextFrameQ.clear();
     }
 
     // Move next-frame tasks
     if (!nextFrameTasks.empty()) {
-        for (auto co : nextFrameTasks) {
-            auto it = tasks.find(co);
-            if (it == tasks.end()) continue;
-            auto& st = it->second;
-            st.status      = Status::Running;
-            st.nextFrame   = false;
-            st.resumeDelta = now - st.lastResumeTime;
-            readyTasks.push_back(co);
+        for (const auto& e : nextFrameTasks) {
+            TaskState* st = FindTask(e.co, e.epoch);
+            if (!st) continue;
+            st->status      = Status::Running;
+            st->nextFrame   = false;
+            st->resumeDelta = now - st->lastResumeTime;
+            readyTasks.push_back(e);
         }
         nextFrameTasks.clear();
     }
 
+    // The frame budget is wall time, independent of the (possibly simulated) clock
+    const double budgetStart = lua_clock();
     const double deadline = (maxTimeBudgetSeconds > 0.0)
-                          ? (now + maxTimeBudgetSeconds)
+                          ? (budgetStart + maxTimeBudgetSeconds)
                           : std::numeric_limits<double>::infinity();
 
     int resumes = 0;
-    double t = now;
+    double t = budgetStart;
 
     // Resume script coroutines
     while (!ready.empty()) {
         if (resumes >= maxResumesPerFrame) break;
         if (t >= deadline) break;
 
-        std::shared_ptr<BaseScript> s = ready.front();
+        ScriptEntry e = std::move(ready.front());
         ready.pop_front();
 
-        auto it = state.find(s.get());
-        if (it == state.end()) continue;
-        auto& st = it->second;
+        auto s = e.s.lock();
+        ScriptState* st = s ? FindScript(s.get(), e.epoch) : nullptr;
+        if (!st) continue;
 
-        if (st.status != Status::Running) {
-            nextFrameQ.push_back(s);
+        if (st->status != Status::Running) {
+            nextFrameQ.push_back(std::move(e));
             continue;
         }
 
-        int nargs = 0;
-        if (st.hasPending) {
-            nargs = st.pendingArgc;
-            st.pendingArgc = 0;
-            st.hasPending  = false;
-            st.passDelta   = false;
-        } else if (st.passDelta && !st.firstResume) {
-            lua_pushnumber(st.co, st.resumeDelta);
-            nargs = 1;
-            st.passDelta = false;
-        }
-
         resumes++;
-        const int r = lua_resume(st.co, nullptr, nargs);
-        st.firstResume = false;
-        st.lastResumeTime = now;
-
-        if (r == LUA_OK) {
-            st.status = Status::Done;
-        } else if (r == LUA_YIELD) {
-            if (st.status == Status::Waiting) {
-                if (st.nextFrame) nextFrameQ.push_back(s);
-                else if (!std::isinf(st.wakeTime)) sleepingByTime.push(s); // only timed waits
-                // else parked on event: do not enqueue
-            } else {
-                nextFrameQ.push_back(s);
-            }
-        } else {
-            LOGE("Luau Runtime Error: %s", lua_tostring(st.co, -1));
-            lua_pop(st.co, 1);
-            st.status = Status::Error;
-        }
+        ResumeScript(s, *st, now);
 
-        if ((resumes & 7) == 0) t = GetTime();
+        if ((resumes & 7) == 0) t = lua_clock();
     }
 
     // Resume TASK coroutines
@@ -419,91 +740,402 @@ void LuaScheduler::Step(double now, double /*dt*/) {
         if (resumes >= maxResumesPerFrame) break;
         if (t >= deadline) break;
 
-        lua_State* co = readyTasks.front();
+        const TaskEntry e = readyTasks.front();
         readyTasks.pop_front();
 
-        auto it = tasks.find(co);
-        if (it == tasks.end()) continue;
-        auto& st = it->second;
+        TaskState* st = FindTask(e.co, e.epoch);
+        if (!st) continue;
 
-        if (st.status != Status::Running) {
-            nextFrameTasks.push_back(co);
+        if (st->status != Status::Running) {
+            nextFrameTasks.push_back(e);
             continue;
         }
 
-        int nargs = 0;
-        if (st.hasPending) {
-            nargs = st.pendingArgc;
-            st.pendingArgc = 0;
-            st.hasPending  = false;
-            st.passDelta   = false;
-        } else if (st.firstResume) {
-            nargs = st.pendingArgc;
-            st.pendingArgc = 0;
-        } else if (st.passDelta) {
-            lua_pushnumber(st.co, st.resumeDelta);
-            nargs = 1;
-            st.passDelta = false;
+        if (ResumeTask(e.co, *st, now)) resumes++;
+
+        if ((resumes & 7) == 0) t = lua_clock();
+    }
+
+    // task.defer: runs once everything above has had its turn. Threads deferred from a
+    // deferred thread run in the same cycle, up to maxDeferDepth rounds.
+    for (int round = 0; round < maxDeferDepth && !deferredTasks.empty(); ++round) {
+        auto batch = std::move(deferredTasks);
+        deferredTasks.clear();
+        for (const auto& e : batch) {
+            TaskState* st = FindTask(e.co, e.epoch);
+            if (!st) continue;
+            ResumeTask(e.co, *st, now);
         }
+    }
 
-        // Check if coroutine is in a valid state to resume
-        int coStatus = lua_status(st.co);
-        
-        // If coroutine has already completed (LUA_OK) and this is not the first resume,
-        // it means it finished execution and should not be resumed again
-        if (coStatus == LUA_OK && !st.firstResume) {
-            LOGI("Cleaning up completed coroutine (status: %d)", coStatus);
-            if (st.registryRef != LUA_NOREF) {
-                lua_unref(L_main, st.registryRef);
-                st.registryRef = LUA_NOREF;
-            }
-            tasks.erase(it);
-            continue;
+    for (int ref : pendingUnrefs) lua_unref(L_main, ref);
+    pendingUnrefs.clear();
+}
+
+// Resumes one script coroutine and files it into the right queue afterwards.
+void LuaScheduler::ResumeScript(const std::shared_ptr<BaseScript>& s, ScriptState& st, double now) {
+    int nargs = 0;
+    if (st.preempted) {
+        // continuing after a watchdog suspend: no wait() result to hand back
+        st.preempted = false;
+        st.passDelta = false;
+    } else if (st.hasPending) {
+        nargs = st.pendingArgc;
+        st.pendingArgc = 0;
+        st.hasPending  = false;
+        st.passDelta   = false;
+    } else if (st.passDelta && !st.firstResume) {
+        lua_pushnumber(st.co, st.resumeDelta);
+        nargs = 1;
+        st.passDelta = false;
+    }
+
+    const uint32_t epoch = st.epoch;
+    ArmWatchdog(st.limits, st.memcat, st.co);
+    const int r = lua_resume(st.co, nullptr, nargs);
+    const bool tripped = DisarmWatchdog();
+
+    // The script may have stopped (or restarted) itself; 'st' is gone or reused then
+    if (!FindScript(s.get(), epoch)) return;
+
+    if (tripped && r == LUA_YIELD) st.preempted = true;
+
+    if (st.memcat && st.limits.memSoftBytes && !st.memWarned) {
+        const size_t used = lua_totalbytes(L_main, st.memcat);
+        if (used > st.limits.memSoftBytes) {
+            st.memWarned = true;
+            LOGW("Script '%s' is using %zu KB of Lua memory (soft limit %zu KB)",
+                 s->Name.c_str(), used / 1024, st.limits.memSoftBytes / 1024);
         }
-        
-        if (coStatus != LUA_YIELD && coStatus != LUA_OK) {
-            LOGE("Luau Runtime Error (task): cannot resume non-suspended coroutine (status: %d)", coStatus);
-            if (st.registryRef != LUA_NOREF) {
-                lua_unref(L_main, st.registryRef);
-                st.registryRef = LUA_NOREF;
-            }
-            tasks.erase(it);
-            continue;
+    }
+    st.firstResume = false;
+    st.lastResumeTime = now;
+
+    if (r == LUA_OK) {
+        st.status = Status::Done;
+    } else if (r == LUA_YIELD) {
+        if (st.status == Status::Waiting) {
+            if (st.parallel) parallelQ.push_back(ScriptEntry{s, epoch});
+            else if (st.nextFrame) nextFrameQ.push_back(ScriptEntry{s, epoch});
+            else if (!std::isinf(st.wakeTime)) sleepingByTime.push(Timed<ScriptEntry>{st.wakeTime, ScriptEntry{s, epoch}}); // only timed waits
+            // else parked on event: do not enqueue
+        } else {
+            nextFrameQ.push_back(ScriptEntry{s, epoch});
         }
+    } else {
+        LOGE("Luau Runtime Error: %s", lua_tostring(st.co, -1));
+        lua_pop(st.co, 1);
+        st.status = Status::Error;
+    }
+}
 
-        resumes++;
-        const int r = lua_resume(st.co, nullptr, nargs);
-        st.firstResume = false;
-        st.lastResumeTime = now;
-
-        if (r == LUA_OK) {
-            // If this task carried a registry ref it is ephemeral and must be unref'd.
-            if (st.registryRef != LUA_NOREF) {
-                lua_unref(L_main, st.registryRef);
-                st.registryRef = LUA_NOREF;
-            } else {
-                // Reusable per-listener coroutine: clear any values left on its stack.
-                lua_settop(st.co, 0);
-            }
-            tasks.erase(it);
-        } else if (r == LUA_YIELD) {
-            if (st.status == Status::Waiting) {
-                if (st.nextFrame) nextFrameTasks.push_back(co);
-                else if (!std::isinf(st.wakeTime)) sleepingTasks.push(co); // only timed waits
-                // else parked on event: do not enqueue
-            } else {
-                nextFrameTasks.push_back(co);
-            }
+// Resumes one task coroutine. Returns false if the task was dropped without resuming.
+bool LuaScheduler::ResumeTask(lua_State* co, TaskState& st, double now) {
+    int nargs = 0;
+    if (st.hasPending) {
+        nargs = st.pendingArgc;
+        st.pendingArgc = 0;
+        st.hasPending  = false;
+        st.passDelta   = false;
+    } else if (st.firstResume) {
+        nargs = st.pendingArgc;
+        st.pendingArgc = 0;
+    } else if (st.passDelta) {
+        lua_pushnumber(st.co, st.resumeDelta);
+        nargs = 1;
+        st.passDelta = false;
+    }
+
+    // Check if coroutine is in a valid state to resume
+    int coStatus = lua_status(st.co);
+
+    // If coroutine has already completed (LUA_OK) and this is not the first resume,
+    // it means it finished execution and should not be resumed again
+    if (coStatus == LUA_OK && !st.firstResume) {
+        LOGI("Cleaning up completed coroutine (status: %d)", coStatus);
+        if (st.registryRef != LUA_NOREF) {
+            lua_unref(L_main, st.registryRef);
+            st.registryRef = LUA_NOREF;
+        }
+        DropTask(co);
+        return false;
+    }
+
+    if (coStatus != LUA_YIELD && coStatus != LUA_OK) {
+        LOGE("Luau Runtime Error (task): cannot resume non-suspended coroutine (status: %d)", coStatus);
+        if (st.registryRef != LUA_NOREF) {
+            lua_unref(L_main, st.registryRef);
+            st.registryRef = LUA_NOREF;
+        }
+        DropTask(co);
+        return false;
+    }
+
+    const uint32_t epoch = st.epoch;
+    // Tasks and listeners run under the limits of the script they are charged to
+    ArmWatchdog(st.memcat ? memcatLimits[st.memcat] : defaultLimits, st.memcat, st.co);
+    const int r = lua_resume(st.co, nullptr, nargs);
+    DisarmWatchdog();
+    if (!FindTask(co, epoch)) return true; // cancelled from inside its own resume
+    st.firstResume = false;
+    st.lastResumeTime = now;
+
+    if (r == LUA_OK) {
+        // Ephemeral task threads are dropped, not pooled: the script may still hold the handle
+        if (st.registryRef != LUA_NOREF) {
+            lua_unref(L_main, st.registryRef);
+            st.registryRef = LUA_NOREF;
         } else {
-            LOGE("Luau Runtime Error (task): %s", lua_tostring(st.co, -1));
-            lua_pop(st.co, 1);
-            if (st.registryRef != LUA_NOREF) {
-                lua_unref(L_main, st.registryRef);
-                st.registryRef = LUA_NOREF;
-            }
-            tasks.erase(it);
+            // Reusable per-listener coroutine: clear any values left on its stack.
+            lua_settop(st.co, 0);
+        }
+        DropTask(co);
+    } else if (r == LUA_YIELD) {
+        if (st.status == Status::Waiting) {
+            if (st.parallel) parallelTasks.push_back(TaskEntry{co, epoch});
+            else if (st.nextFrame) nextFrameTasks.push_back(TaskEntry{co, epoch});
+            else if (!std::isinf(st.wakeTime)) sleepingTasks.push(Timed<TaskEntry>{st.wakeTime, TaskEntry{co, epoch}}); // only timed waits
+            // else parked on event: do not enqueue
+        } else {
+            nextFrameTasks.push_back(TaskEntry{co, epoch});
         }
+    } else {
+        // blame the script that spawned the task or connected the listener
+        const std::string owner = OwnerName(st.memcat);
+        if (owner.empty()) LOGE("Luau Runtime Error (task): %s", lua_tostring(st.co, -1));
+        else LOGE("Luau Runtime Error (task of '%s'): %s", owner.c_str(), lua_tostring(st.co, -1));
+        lua_pop(st.co, 1);
+        if (st.registryRef != LUA_NOREF) {
+            lua_unref(L_main, st.registryRef);
+            st.registryRef = LUA_NOREF;
+        }
+        DropTask(co);
+    }
+    return true;
+}
 
-        if ((resumes & 7) == 0) t = GetTime();
+// Ends a task's bookkeeping; the first free map node is kept for RunTaskNow
+void LuaScheduler::DropTask(lua_State* co) {
+    auto node = tasks.extract(co);
+    if (node && spareTaskNode.empty()) spareTaskNode = std::move(node);
+}
+
+// ======= Coroutine pool =======
+
+LuaScheduler::PooledThread LuaScheduler::AcquireThread(int memcat) {
+    PooledThread t;
+    if (!L_main) return t;
+    poolStats.acquires++;
+
+    if (threadPool.empty()) {
+        poolStats.creations++;
+        poolCreationsThisFrame++;
+        return NewTaskThread(memcat);
     }
+    t = threadPool.front();
+    threadPool.pop_front();
+    poolStats.hits++;
+    poolStats.idle = threadPool.size();
+
+    lua_setmemcat(t.co, memcat);
+    return t;
+}
+
+LuaScheduler::PooledThread LuaScheduler::NewTaskThread(int memcat) {
+    PooledThread t;
+    if (!L_main) return t;
+    lua_newthread(L_main);
+    t.co = lua_tothread(L_main, -1);
+    luaL_sandboxthread(t.co);
+    t.ref = lua_ref(L_main, -1);
+    lua_pop(L_main, 1);
+    lua_setmemcat(t.co, memcat);
+    return t;
+}
+
+void LuaScheduler::ReleaseThread(const PooledThread& t) {
+    if (!L_main || !t.co || t.ref == LUA_NOREF) return;
+    if (threadPool.size() >= threadPoolMax) {
+        lua_unref(L_main, t.ref);
+        poolStats.discards++;
+        return;
+    }
+    // engine-owned while idle; the next owner sets its own category
+    lua_setmemcat(t.co, 0);
+    lua_resetthread(t.co);
+    threadPool.push_back(t);
+    poolStats.idle = threadPool.size();
+}
+
+bool LuaScheduler::RunTaskNow(const PooledThread& t, int argc, int memcat) {
+    if (!L_main || !t.co) return true;
+    lua_State* co = t.co;
+
+    TaskState* slot = nullptr;
+    if (!spareTaskNode.empty()) {
+        spareTaskNode.key() = co;
+        auto ins = tasks.insert(std::move(spareTaskNode));
+        if (!ins.inserted) spareTaskNode = std::move(ins.node);
+        slot = &ins.position->second;
+    } else {
+        slot = &tasks[co];
+    }
+    auto& st = *slot;
+    st              = TaskState{};
+    st.epoch        = NewEpoch();
+    st.status       = Status::Running;
+    st.co           = co;
+    st.registryRef  = LUA_NOREF;   // still the caller's while it runs
+    st.lastResumeTime = EngineClock::Get().Now();
+    st.pendingArgc  = argc;
+    st.memcat       = memcat;
+    const uint32_t epoch = st.epoch;
+
+    // Fired from inside another resume (a script firing an event, a listener firing
+    // another): that resume's watchdog picks up where it was once we're done
+    const Watchdog outer = watchdog;
+    ResumeTask(co, st, st.lastResumeTime);
+    watchdog = outer;
+
+    TaskState* parked = FindTask(co, epoch);
+    if (!parked) return true;
+    parked->registryRef = t.ref; // yielded: an ordinary task from now on
+    return false;
+}
+
+// ======= GC pacer =======
+
+static double HeapKB(lua_State* L) {
+    return lua_gc(L, LUA_GCCOUNT, 0) + lua_gc(L, LUA_GCCOUNTB, 0) / 1024.0;
+}
+
+void LuaScheduler::StepGc(double now, double frameDeadline) {
+    if (!L_main) return;
+
+    // Allocation since the last run becomes debt. Frees (assists, finished cycles) only
+    // show up as a shrinking heap, which simply means nothing new is owed.
+    const double heapKB = HeapKB(L_main);
+    const double grown  = std::max(0.0, heapKB - gcLastHeapKB);
+    const double dt     = now - gcLastTime;
+    if (gcLastTime > 0.0 && dt > 0.0) {
+        gcStats.allocKBps = gcStats.allocKBps * 0.9 + (grown / dt) * 0.1;
+    }
+    gcLastTime = now;
+    gcDebtKB   = std::min(gcDebtKB + grown * gcStepMul, heapKB); // a full cycle clears any debt
+
+    const double remaining = frameDeadline - now - gcSafetyMarginSeconds;
+    if (remaining <= gcStepSeconds) {
+        // too close to the deadline; the VM's allocation assists keep the heap bounded
+        gcStats.backoffs++;
+        gcStats.lastStepMs = 0.0;
+        gcStats.heapBytes  = (size_t)(heapKB * 1024.0);
+        gcLastHeapKB       = heapKB;
+        return;
+    }
+
+    // With time to spare, also chip away at a cycle if the heap grew since the last one
+    const bool idle = remaining >= gcIdleSeconds && heapKB > gcCycleHeapKB * 1.05;
+
+    const double start = lua_clock();
+    const double end   = start + remaining;
+    double t = start;
+    while (gcDebtKB > 0.0 || idle) {
+        // stop if the next step likely won't fit
+        if (t + gcStepSeconds >= end) break;
+
+        const int finished = lua_gc(L_main, LUA_GCSTEP, gcStepKB);
+        const double after = lua_clock();
+        gcStepSeconds = (gcStats.steps == 0) ? (after - t) : gcStepSeconds * 0.9 + (after - t) * 0.1;
+        t = after;
+
+        gcStats.steps++;
+        gcDebtKB -= gcStepKB;
+        if (finished) {
+            gcStats.pauses++;
+            gcDebtKB      = 0.0;
+            gcCycleHeapKB = HeapKB(L_main);
+            break;
+        }
+    }
+    if (gcDebtKB < 0.0) gcDebtKB = 0.0;
+
+    gcStats.lastStepMs = (t - start) * 1000.0;
+    gcStats.maxStepMs  = std::max(gcStats.maxStepMs, gcStats.lastStepMs);
+    gcLastHeapKB       = HeapKB(L_main);
+    gcStats.heapBytes  = (size_t)(gcLastHeapKB * 1024.0);
+}
+
+// ======= Parallel phase (Actors) =======
+
+static thread_local bool tl_inParallel = false;
+
+bool LuaScheduler::InParallelPhase() { return tl_inParallel; }
+
+LuaScheduler* LuaScheduler::FromState(lua_State* L) {
+    return L ? static_cast<LuaScheduler*>(lua_callbacks(L)->userdata) : nullptr;
+}
+
+lua_CompileOptions LuaScheduler::CompileOptions() {
+    lua_CompileOptions opts{};
+    opts.optimizationLevel = 1;
+    opts.debugLevel        = 1;
+
+    static const char* kMutable[] = {
+        "game", "workspace", "script", "shared", "plugin", nullptr
+    };
+    opts.mutableGlobals = kMutable;  // NULL-terminated
+
+    opts.vectorLib  = "Vector3";
+    opts.vectorCtor = "new";
+    opts.vectorType = "Vector3";
+    return opts;
+}
+
+void LuaScheduler::SetWaitParallel(BaseScript* s) {
+    auto it = state.find(s);
+    if (it == state.end()) return;
+    auto& st = it->second;
+    st.status    = Status::Waiting;
+    st.nextFrame = false;
+    st.parallel  = true;
+}
+
+void LuaScheduler::SetTaskWaitParallel(lua_State* co) {
+    auto it = tasks.find(co);
+    if (it == tasks.end()) return;
+    auto& st = it->second;
+    st.status    = Status::Waiting;
+    st.nextFrame = false;
+    st.parallel  = true;
+}
+
+void LuaScheduler::RunParallelPhase(double now) {
+    if (!L_main) return;
+    tl_inParallel = true;
+
+    // Anything that desynchronizes again during this pass waits for the next frame's pass
+    auto scripts = std::move(parallelQ);
+    parallelQ.clear();
+    for (auto& e : scripts) {
+        auto s = e.s.lock();
+        ScriptState* st = s ? FindScript(s.get(), e.epoch) : nullptr;
+        if (!st) continue;
+        st->status    = Status::Running;
+        st->parallel  = false;
+        st->passDelta = false;
+        ResumeScript(s, *st, now);
+    }
+
+    auto threads = std::move(parallelTasks);
+    parallelTasks.clear();
+    for (const auto& e : threads) {
+        TaskState* st = FindTask(e.co, e.epoch);
+        if (!st) continue;
+        st->status    = Status::Running;
+        st->parallel  = false;
+        st->passDelta = false;
+        ResumeTask(e.co, *st, now);
+    }
+
+    tl_inParallel = false;
 }
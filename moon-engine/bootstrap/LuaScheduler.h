@@ -1,6 +1,7 @@
 // ================== bootstrap/LuaScheduler.h ==================
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <deque>
 #include <functional>
@@ -16,6 +17,7 @@
 #include "luacode.h"
 
 struct BaseScript;  // opaque to the scheduler
+struct RTScriptSignal;
 
 class LuaScheduler {
 public:
@@ -23,6 +25,22 @@ public:
 
     enum class Status { New, Running, Waiting, Done, Error };
 
+    // What the watchdog does when a single resume runs past its budget.
+    enum class TimeoutAction { Error, Suspend };
+
+    // Per-script execution limits. Scripts can override the defaults with
+    // "--&timeout=<ms>", "--&ontimeout=error|suspend", "--&memwarn=<KB>" and
+    // "--&memlimit=<KB>" directives.
+    struct ScriptLimits {
+        double        maxResumeSeconds = 10.0;                 // 0 = no watchdog
+        TimeoutAction onTimeout        = TimeoutAction::Error;
+        size_t        memSoftBytes     = 0;                    // warn once past this, 0 = off
+        size_t        memHardBytes     = 0;                    // error the script past this, 0 = off
+        // memHardBytes is enforced at interrupts during the script's own resumes (its
+        // body, tasks and listeners). Memory charged to it outside them, e.g. values the
+        // engine pushes for it, is counted but never refused.
+    };
+
     LuaScheduler();
     ~LuaScheduler();
 
@@ -31,7 +49,8 @@ public:
     void AddScript(const std::shared_ptr<BaseScript>& script,
                    const std::string&                 name,
                    const std::string&                 source,
-                   const GlobalBinder&                binder);
+                   const GlobalBinder&                binder,
+                   std::string                        bytecode = {}); // from CompileOptions(); compiled here if empty
 
     void StopScript(BaseScript* s);
     void StopScript(const std::shared_ptr<BaseScript>& s) { StopScript(s.get()); }
@@ -44,8 +63,9 @@ public:
     void SetWaitEvent(BaseScript* s);
 
     // Task API (thread-based, not tied to BaseScript)
-    void ScheduleTaskNextFrame(lua_State* co, int registryRef, int initialArgc);
-    void ScheduleTaskAt(lua_State* co, int registryRef, double wakeTimeAbs, int initialArgc);
+    void ScheduleTaskNextFrame(lua_State* co, int registryRef, int initialArgc, int memcat = 0);
+    void ScheduleTaskAt(lua_State* co, int registryRef, double wakeTimeAbs, int initialArgc, int memcat = 0);
+    void ScheduleTaskDeferred(lua_State* co, int registryRef, int initialArgc, int memcat = 0); // end of this cycle
     void SetTaskWaitAbs(lua_State* co, double wakeTimeAbs);
     void SetTaskWaitNextFrame(lua_State* co);
     void SetTaskWaitEvent(lua_State* co);
@@ -57,9 +77,129 @@ public:
     // For RTScriptSignal::Wait() on scripts
     lua_State* GetScriptThread(BaseScript* s);
 
+    // task.cancel: drops a task, or stops the script whose main thread 'co' is. Queue and
+    // timer entries it leaves behind no longer match its epoch and are skipped when they
+    // come up, so nothing is searched. Returns false if nothing here owned 'co'.
+    bool CancelThread(lua_State* co);
+
+    // Every (re)scheduled script or task gets a fresh epoch (0 = not scheduled). Anything that
+    // parks a thread outside the scheduler, like RTScriptSignal waiters, keeps the epoch and
+    // checks it before waking, so a cancelled or restarted thread is left alone.
+    uint32_t ScriptEpoch(BaseScript* s) const;
+    uint32_t TaskEpoch(lua_State* co) const;
+    bool IsScriptCurrent(BaseScript* s, uint32_t epoch) const { return epoch && ScriptEpoch(s) == epoch; }
+    bool IsTaskCurrent(lua_State* co, uint32_t epoch) const   { return epoch && TaskEpoch(co) == epoch; }
+
+    // Watchdog limits for an already scheduled script
+    void SetScriptLimits(BaseScript* s, const ScriptLimits& limits);
+
+    // Applied to new scripts (before directives) and to task threads not charged to a script
+    ScriptLimits defaultLimits;
+
+    // ===== Memory accounting =====
+    // Every script gets its own Luau memory category; tasks it spawns and signal
+    // listeners it connects allocate under the same category.
+    int    MemCategoryOf(lua_State* L) const;            // 0 = shared/engine
+    size_t GetScriptMemory(BaseScript* s) const;         // bytes currently charged to the script
+
+    // Scheduler owning the VM that 'L' belongs to
+    static LuaScheduler* FromState(lua_State* L);
+
+    // Options every script and module is compiled with. Vector3.new is registered as
+    // the vector constructor, so it compiles to a fastcall that builds a native vector.
+    static lua_CompileOptions CompileOptions();
+
+    // ===== Coroutine pool =====
+    // Signal dispatch draws listener threads from a pool of reset threads instead of
+    // creating and sandboxing a new one per call. A pooled thread keeps its registry
+    // ref and is reset with lua_resetthread when it comes back. task.spawn/delay/defer
+    // threads are not pooled: scripts hold them as handles (task.cancel,
+    // coroutine.status), and a recycled thread would alias a later task.
+    struct PooledThread {
+        lua_State* co  = nullptr;
+        int        ref = LUA_NOREF;   // registry ref that keeps the thread alive
+    };
+    struct ThreadPoolStats {
+        uint64_t acquires           = 0;
+        uint64_t hits               = 0;   // served from the pool
+        uint64_t creations          = 0;   // lua_newthread calls
+        uint64_t discards           = 0;   // released while the pool was full
+        uint32_t creationsLastFrame = 0;
+        size_t   idle               = 0;
+        double HitRate() const { return acquires ? double(hits) / double(acquires) : 0.0; }
+    };
+
+    PooledThread AcquireThread(int memcat = 0);
+    void         ReleaseThread(const PooledThread& t);   // resets 't' and returns it to the pool
+    // A fresh sandboxed thread, outside the pool; task.spawn/delay/defer use it directly
+    PooledThread NewTaskThread(int memcat);
+    const ThreadPoolStats& GetThreadPoolStats() const { return poolStats; }
+
+    // Signal listeners: runs the function on 't' (pooled, 'argc' args above it) as a task,
+    // right now, so it can wait() or :Wait() like any other thread. Returns true once it
+    // has finished or errored and 't' can be reused; false if it yielded, in which case
+    // the scheduler owns 't' and its ref from here on.
+    bool RunTaskNow(const PooledThread& t, int argc, int memcat);
+
+    size_t threadPoolMax = 256;   // idle threads kept around
+
+    // ===== Connection ownership =====
+    // Every Lua connection is filed under the script (memory category) that made it, so
+    // StopScript can disconnect them all: a stopped or destroyed script leaves no
+    // listener behind. Connections made from shared code (category 0, e.g. a module's
+    // top level) have no owner and last as long as their signal.
+    void TrackConnection(int memcat, const std::weak_ptr<RTScriptSignal>& sig, size_t id);
+
+    struct ConnectionReport {
+        size_t owned    = 0;
+        size_t unowned  = 0;
+        size_t orphaned = 0;   // still connected, owner no longer running; should stay 0
+    };
+    ConnectionReport GetConnectionReport() const;
+    // Logs the orphaned connections, one line per signal
+    void LogOrphanedConnections() const;
+
+    // ===== Parallel phase (Actors) =====
+    // Each Actor owns its own scheduler/VM. task.desynchronize() parks a thread until
+    // RunParallelPhase, which the actor runtime calls from a worker thread while the
+    // main thread is blocked, so the DataModel is a read-only snapshot meanwhile.
+    static bool InParallelPhase();   // true on the thread currently running desynchronized code
+
+    bool IsActorVM() const { return actorVM; }
+    void SetActorVM(bool v) { actorVM = v; }
+
+    void SetWaitParallel(BaseScript* s);
+    void SetTaskWaitParallel(lua_State* co);
+    void RunParallelPhase(double now);
+    bool HasParallelWork() const { return !parallelQ.empty() || !parallelTasks.empty(); }
+
     int    maxResumesPerFrame   = 4096;
+    int    maxDeferDepth        = 80;      // task.defer rounds per Step before spilling to the next one
     double maxTimeBudgetSeconds = 0.010;
 
+    // ===== GC pacing =====
+    // Step() no longer collects; the frame loop calls StepGc once the frame's real work
+    // (scripts, render) is done and hands it the frame deadline. The pacer pays back
+    // this frame's allocation debt, spends leftover time finishing the current cycle,
+    // and backs off entirely when the frame is already close to its deadline.
+    struct GcStats {
+        size_t   heapBytes      = 0;    // after the last pacer run
+        double   allocKBps      = 0.0;  // smoothed allocation rate
+        double   lastStepMs     = 0.0;  // time spent collecting last frame
+        double   maxStepMs      = 0.0;
+        uint64_t steps          = 0;    // explicit LUA_GCSTEP calls
+        uint64_t pauses         = 0;    // cycles that finished and reached the pause state
+        uint64_t backoffs       = 0;    // frames skipped because the deadline was too close
+    };
+
+    void StepGc(double now, double frameDeadline);
+    const GcStats& GetGcStats() const { return gcStats; }
+
+    int    gcStepKB              = 64;     // work per LUA_GCSTEP call
+    double gcStepMul             = 2.0;    // collect this many KB per KB allocated
+    double gcSafetyMarginSeconds = 0.001;  // never collect inside the last ms of a frame
+    double gcIdleSeconds         = 0.004;  // leftover time that counts as "idle"
+
     uint64_t frameIndex = 0;
 
     LuaScheduler(const LuaScheduler&)            = delete;
@@ -82,6 +222,15 @@ private:
         // pending arguments
         bool       hasPending     = false;
         int        pendingArgc    = 0;
+        // watchdog
+        ScriptLimits limits;
+        bool       preempted      = false; // suspended mid-execution by the watchdog
+        bool       parallel       = false; // parked by task.desynchronize()
+        // memory
+        int        memcat         = 0;
+        bool       memWarned      = false;
+        uint32_t   epoch          = 0;
+        int        threadRef      = LUA_NOREF; // keeps the script thread alive
     };
 
     struct TaskState {
@@ -98,51 +247,106 @@ private:
         // pending arguments
         bool       hasPending     = false;
         int        pendingArgc    = 0;
+        bool       parallel       = false; // parked by task.desynchronize()
+        int        memcat         = 0;     // inherited from the spawning script
+        uint32_t   epoch          = 0;
     };
 
+    // Queue/timer entries remember the epoch they were queued under (see CancelThread)
+    struct ScriptEntry {
+        std::weak_ptr<BaseScript> s;
+        uint32_t                  epoch = 0;
+    };
+    struct TaskEntry {
+        lua_State* co    = nullptr;
+        uint32_t   epoch = 0;
+    };
+    template <class E>
+    struct Timed {
+        double wake = 0.0;
+        E      entry;
+        bool operator>(const Timed& o) const { return wake > o.wake; }
+    };
+    template <class E>
+    using TimerHeap = std::priority_queue<Timed<E>, std::vector<Timed<E>>, std::greater<Timed<E>>>;
+
+    uint32_t     nextEpoch = 0;
+    uint32_t     NewEpoch() { if (++nextEpoch == 0) ++nextEpoch; return nextEpoch; }
+    ScriptState* FindScript(BaseScript* s, uint32_t epoch);
+    TaskState*   FindTask(lua_State* co, uint32_t epoch);
+
+    std::vector<int> pendingUnrefs;   // released at the end of Step
+    void UnrefLater(int ref);
+    void CancelTasksOf(int memcat);   // tasks charged to one script
+    void DisconnectOwnedBy(int memcat);
+    std::string OwnerName(int memcat) const; // script a task or listener belongs to, for errors
+    void DropTask(lua_State* co);
+
     lua_State* L_main = nullptr;
+    bool       actorVM = false;
 
-    // BaseScript coroutines
-    std::unordered_map<BaseScript*, ScriptState> state;
-    std::deque<std::shared_ptr<BaseScript>> ready;
-    std::deque<std::shared_ptr<BaseScript>> nextFrameQ;
-
-    struct TimeCmp {
-        const std::unordered_map<BaseScript*, ScriptState>* st = nullptr;
-        bool operator()(const std::shared_ptr<BaseScript>& a,
-                        const std::shared_ptr<BaseScript>& b) const {
-            const auto ia = st->find(a.get());
-            const auto ib = st->find(b.get());
-            const double ta = (ia == st->end()) ? 0.0 : ia->second.wakeTime;
-            const double tb = (ib == st->end()) ? 0.0 : ib->second.wakeTime;
-            return ta > tb; // min-heap
-        }
+    // Connections by owning memory category; entries of connections that have since
+    // been disconnected are pruned when a list doubles
+    struct OwnedConnection {
+        std::weak_ptr<RTScriptSignal> sig;
+        size_t                        id = 0;
     };
+    std::array<std::vector<OwnedConnection>, LUA_MEMORY_CATEGORIES> connectionsByOwner;
+
+    // Coroutine pool state
+    std::deque<PooledThread> threadPool;
+    ThreadPoolStats          poolStats;
+    uint32_t                 poolCreationsThisFrame = 0;
+
+    // GC pacer state
+    GcStats gcStats;
+    double  gcLastTime     = 0.0;
+    double  gcLastHeapKB   = 0.0;
+    double  gcDebtKB       = 0.0;
+    double  gcCycleHeapKB  = 0.0;  // heap size when the last cycle finished
+    double  gcStepSeconds  = 0.0;  // smoothed cost of one LUA_GCSTEP
+
+    void ResumeScript(const std::shared_ptr<BaseScript>& s, ScriptState& st, double now);
+    bool ResumeTask(lua_State* co, TaskState& st, double now);
+
+    // Watchdog state for the resume currently in flight
+    struct Watchdog {
+        bool          armed    = false;
+        bool          tripped  = false;
+        double        deadline = 0.0;   // lua_clock() seconds
+        double        budget   = 0.0;
+        TimeoutAction action   = TimeoutAction::Error;
+        int           memcat   = 0;
+        size_t        memHard  = 0;     // bytes, 0 = unchecked
+        lua_State*    thread   = nullptr; // the thread being resumed; the only one Suspend yields
+    } watchdog;
+
+    // Memory categories: 1..255 are handed out to scripts. A stopped script's category
+    // is only reused once everything it allocated has been collected.
+    std::array<ScriptLimits, LUA_MEMORY_CATEGORIES> memcatLimits{}; // owning script's limits, for its tasks
+    std::vector<int> retiredMemcats;
+    int              nextMemcat = 1;
+    int  AllocMemCategory();
 
-    std::priority_queue<
-        std::shared_ptr<BaseScript>,
-        std::vector<std::shared_ptr<BaseScript>>,
-        TimeCmp
-    > sleepingByTime;
+    void ArmWatchdog(const ScriptLimits& limits, int memcat, lua_State* co);
+    bool DisarmWatchdog(); // returns true if the watchdog fired during the resume
+    static void OnInterrupt(lua_State* L, int gc);
+
+    // BaseScript coroutines
+    std::unordered_map<BaseScript*, ScriptState> state;
+    std::deque<ScriptEntry> ready;
+    std::deque<ScriptEntry> nextFrameQ;
+    std::deque<ScriptEntry> parallelQ;
+    TimerHeap<ScriptEntry>  sleepingByTime;   // min-heap on wake time
 
     // Task coroutines (plain Luau threads)
     std::unordered_map<lua_State*, TaskState> tasks;
-    std::deque<lua_State*> readyTasks;
-    std::deque<lua_State*> nextFrameTasks;
-
-    struct TaskTimeCmp {
-        const std::unordered_map<lua_State*, TaskState>* st = nullptr;
-        bool operator()(lua_State* a, lua_State* b) const {
-            auto ia = st->find(a), ib = st->find(b);
-            const double ta = (ia == st->end()) ? 0.0 : ia->second.wakeTime;
-            const double tb = (ib == st->end()) ? 0.0 : ib->second.wakeTime;
-            return ta > tb; // min-heap
-        }
-    };
-
-    std::priority_queue<
-        lua_State*,
-        std::vector<lua_State*>,
-        TaskTimeCmp
-    > sleepingTasks;
+    // A finished task's map node, kept for the next RunTaskNow so a listener that
+    // runs to completion doesn't allocate (see DropTask)
+    std::unordered_map<lua_State*, TaskState>::node_type spareTaskNode;
+    std::deque<TaskEntry> readyTasks;
+    std::deque<TaskEntry> nextFrameTasks;
+    std::deque<TaskEntry> parallelTasks;
+    std::deque<TaskEntry> deferredTasks;
+    TimerHeap<TaskEntry>  sleepingTasks;
 };
@@ -0,0 +1,328 @@
+// ================== bootstrap/ModuleLoader.cpp ==================
+#include "bootstrap/ModuleLoader.h"
+#include "bootstrap/EngineClock.h"
+#include "bootstrap/Game.h"
+#include "bootstrap/LuaScheduler.h"
+#include "bootstrap/ScriptingAPI.h"
+#include "bootstrap/instances/ModuleScript.h"
+#include "core/logging/Logging.h"
+#include "subsystems/filesystem/FileSystem.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// Luau
+#include "lua.h"
+#include "lualib.h"
+#include "luacode.h"
+#include "Luau/Require.h"
+
+extern std::shared_ptr<Game> g_game;
+
+namespace fs = std::filesystem;
+
+static const char* kLoaderKey    = "Librebox.ModuleLoader";
+// The table require-by-string caches results in; require(instance) shares it
+static const char* kModulesTable = "_MODULES";
+
+static luarequire_WriteResult WriteOut(const std::string& s, char* buffer, size_t size, size_t* sizeOut) {
+    *sizeOut = s.size() + 1;
+    if (size < *sizeOut) return WRITE_BUFFER_TOO_SMALL;
+    std::memcpy(buffer, s.c_str(), *sizeOut);
+    return WRITE_SUCCESS;
+}
+
+static std::string DiskKey(const fs::path& file) {
+    std::error_code ec;
+    fs::path abs = fs::absolute(file, ec);
+    return (ec ? file : abs).lexically_normal().string();
+}
+
+void ModuleLoader::Open(lua_State* L) {
+    void* mem = lua_newuserdatadtor(L, sizeof(ModuleLoader), [](void* p) {
+        static_cast<ModuleLoader*>(p)->~ModuleLoader();
+    });
+    auto* self = new (mem) ModuleLoader();
+    lua_setfield(L, LUA_REGISTRYINDEX, kLoaderKey); // the registry keeps it for the VM's lifetime
+
+    luarequire_pushrequire(L, &ModuleLoader::InitConfig, self);
+    lua_pushlightuserdata(L, self);
+    lua_pushcclosure(L, &ModuleLoader::l_require, "require", 2);
+    lua_setglobal(L, "require");
+}
+
+ModuleLoader* ModuleLoader::Get(lua_State* L) {
+    lua_getfield(L, LUA_REGISTRYINDEX, kLoaderKey);
+    auto* self = static_cast<ModuleLoader*>(lua_touserdata(L, -1));
+    lua_pop(L, 1);
+    return self;
+}
+
+std::string ModuleLoader::ChunkNameFor(const std::shared_ptr<LuaSourceContainer>& src) {
+    if (!src) return "?";
+    if (!src->SourcePath.empty()) return RegisterChunk(src->SourcePath, Requirer{src, DiskKey(src->SourcePath)});
+    return RegisterChunk(src->GetFullName(), Requirer{src, {}});
+}
+
+std::string ModuleLoader::RegisterChunk(const std::string& base, const Requirer& r) {
+    // Dead entries pile up as scripts come and go; sweep them now and then
+    if (chunks.size() >= 1024 && chunks.size() % 256 == 0) {
+        for (auto it = chunks.begin(); it != chunks.end();) {
+            if (it->second.file.empty() && it->second.inst.expired()) it = chunks.erase(it);
+            else ++it;
+        }
+        for (auto it = instanceKeys.begin(); it != instanceKeys.end();) {
+            if (it->second.first.expired()) it = instanceKeys.erase(it);
+            else ++it;
+        }
+    }
+
+    // Two scripts can share a full name; the second one gets "Name#2" and so on
+    const auto owner = r.inst.lock();
+    std::string name = base;
+    for (int n = 2;; ++n) {
+        auto it = chunks.find(name);
+        if (it == chunks.end()
+            || (it->second.file.empty() && it->second.inst.expired())
+            || (it->second.file == r.file && it->second.inst.lock() == owner)) {
+            chunks[name] = r;
+            return name;
+        }
+        name = base + "#" + std::to_string(n);
+    }
+}
+
+std::string ModuleLoader::InstanceKey(const std::shared_ptr<Instance>& inst) {
+    // Keyed by object, not by name: a new instance at a recycled address gets a new key
+    auto& slot = instanceKeys[inst.get()];
+    if (slot.first.lock() != inst) {
+        slot.first  = inst;
+        slot.second = "instance:" + std::to_string(nextInstanceKey++);
+    }
+    return slot.second;
+}
+
+fs::path ModuleLoader::ModuleFile(const fs::path& path, int* matches) {
+    const fs::path candidates[] = {
+        fs::path(path.string() + ".luau"),
+        fs::path(path.string() + ".lua"),
+        path / "init.luau",
+        path / "init.lua",
+    };
+    fs::path found;
+    int n = 0;
+    std::error_code ec;
+    for (const auto& c : candidates) {
+        if (!fs::is_regular_file(c, ec)) continue;
+        if (found.empty()) found = c;
+        ++n;
+    }
+    if (matches) *matches = n;
+    return found;
+}
+
+int ModuleLoader::Run(lua_State* L, const Cursor& at, const std::string& chunkname, const std::string& key) {
+    if (loading.count(key)) {
+        luaL_error(L, "cyclic require of '%s'", chunkname.c_str() + 1);
+    }
+
+    const double start = EngineClock::Wall();
+
+    std::string source;
+    if (at.onDisk) source = fsys::ReadFileToString(ModuleFile(at.path).string());
+    else if (at.inst)  source = static_cast<LuaSourceContainer*>(at.inst.get())->GetSource();
+
+    lua_CompileOptions opts = LuaScheduler::CompileOptions();
+    size_t bcSize = 0;
+    char* bytecode = luau_compile(source.data(), source.size(), &opts, &bcSize);
+
+    // Fresh thread off the main thread, so the module sees the VM's globals rather than
+    // the requiring script's, and its allocations stay shared (category 0)
+    lua_State* GL = lua_mainthread(L);
+    lua_State* ML = lua_newthread(GL);
+    lua_xmove(GL, L, 1); // anchored on L while it runs
+    lua_setmemcat(ML, 0);
+    luaL_sandboxthread(ML);
+
+    if (at.inst) Lua_PushInstance(ML, at.inst);
+    else lua_pushnil(ML);
+    lua_setglobal(ML, "script");
+    if (g_game && g_game->workspace) Lua_PushInstance(ML, g_game->workspace);
+    else lua_pushnil(ML);
+    lua_setglobal(ML, "workspace");
+
+    bool ok = false;
+    const int loadStatus = bytecode ? luau_load(ML, chunkname.c_str(), bytecode, bcSize, 0) : 1;
+    if (!bytecode) lua_pushstring(ML, "compiler ran out of memory");
+    free(bytecode);
+
+    if (loadStatus == 0) {
+        loading.insert(key);
+        const int status = lua_resume(ML, L, 0);
+        loading.erase(key);
+
+        if (status == LUA_OK && lua_gettop(ML) == 1) {
+            ok = true;
+        } else if (status == LUA_OK) {
+            lua_settop(ML, 0);
+            lua_pushstring(ML, "Module code did not return exactly one value");
+        } else if (status == LUA_YIELD) {
+            lua_settop(ML, 0);
+            lua_pushstring(ML, "Module code yielded; modules must return without yielding");
+        } else if (!lua_isstring(ML, -1)) {
+            lua_pushstring(ML, "unknown error while running module");
+        }
+    }
+
+    lua_xmove(ML, L, 1);
+    if (!ok) lua_error(L);
+    lua_remove(L, -2); // the thread
+
+    LOGI("require: %s loaded in %.2f ms", chunkname.c_str() + 1, (EngineClock::Wall() - start) * 1000.0);
+    return 1;
+}
+
+// require(path) goes to the require-by-string closure (upvalue 1); require(ModuleScript)
+// is resolved here and cached in the same table.
+int ModuleLoader::l_require(lua_State* L) {
+    if (lua_type(L, 1) != LUA_TUSERDATA) {
+        lua_settop(L, 1);
+        lua_pushvalue(L, lua_upvalueindex(1));
+        lua_insert(L, 1);
+        lua_call(L, 1, 1);
+        return 1;
+    }
+
+    auto* self = static_cast<ModuleLoader*>(lua_tolightuserdata(L, lua_upvalueindex(2)));
+    auto* ud = Lua_CheckInstance(L, 1);
+    auto module = std::dynamic_pointer_cast<ModuleScript>(*ud);
+    if (!module || !self) luaL_error(L, "Attempted to call require with invalid argument(s).");
+
+    const std::string key = self->InstanceKey(module);
+    lua_settop(L, 1);
+    luaL_findtable(L, LUA_REGISTRYINDEX, kModulesTable, 1);
+    lua_getfield(L, 2, key.c_str());
+    if (!lua_isnil(L, -1)) return 1;
+    lua_pop(L, 1);
+
+    Cursor at;
+    at.inst = module;
+    const std::string chunkname = "@" + self->RegisterChunk(module->GetFullName(), Requirer{module, {}});
+    self->Run(L, at, chunkname, key);
+
+    lua_pushvalue(L, -1);
+    lua_setfield(L, 2, key.c_str());
+    return 1;
+}
+
+void ModuleLoader::InitConfig(luarequire_Configuration* config) {
+    config->is_require_allowed = [](lua_State*, void*, const char* chunkname) {
+        return chunkname && chunkname[0] == '@';
+    };
+
+    config->reset = [](lua_State*, void* ctx, const char* chunkname) {
+        auto* self = static_cast<ModuleLoader*>(ctx);
+        auto it = self->chunks.find(chunkname + 1);
+        if (it == self->chunks.end()) return NAVIGATE_NOT_FOUND;
+
+        Cursor c;
+        if (!it->second.file.empty()) {
+            // a script or module on disk; init.lua stands for its folder
+            const fs::path& f = it->second.file;
+            c.onDisk = true;
+            c.path   = f.stem() == "init" ? f.parent_path() : f.parent_path() / f.stem();
+        } else {
+            c.inst = it->second.inst.lock();
+            if (!c.inst) return NAVIGATE_NOT_FOUND;
+        }
+        self->cursor = std::move(c);
+        return NAVIGATE_SUCCESS;
+    };
+
+    config->jump_to_alias = [](lua_State*, void* ctx, const char* path) {
+        auto* self = static_cast<ModuleLoader*>(ctx);
+        if (!self->cursor.onDisk) return NAVIGATE_NOT_FOUND;
+        self->cursor.path = fs::path(path).lexically_normal();
+        return NAVIGATE_SUCCESS;
+    };
+
+    config->to_parent = [](lua_State*, void* ctx) {
+        auto* self = static_cast<ModuleLoader*>(ctx);
+        Cursor& c = self->cursor;
+        if (c.onDisk) {
+            fs::path up = c.path.parent_path();
+            if (up.empty() || up == c.path) return NAVIGATE_NOT_FOUND;
+            c.path = std::move(up);
+            return NAVIGATE_SUCCESS;
+        }
+        auto up = c.inst ? c.inst->Parent.lock() : nullptr;
+        if (!up) return NAVIGATE_NOT_FOUND;
+        c.inst = std::move(up);
+        return NAVIGATE_SUCCESS;
+    };
+
+    config->to_child = [](lua_State*, void* ctx, const char* name) {
+        auto* self = static_cast<ModuleLoader*>(ctx);
+        Cursor& c = self->cursor;
+        if (c.onDisk) {
+            fs::path next = c.path / name;
+            int matches = 0;
+            ModuleFile(next, &matches);
+            std::error_code ec;
+            if (matches > 1) return NAVIGATE_AMBIGUOUS;
+            if (matches == 0 && !fs::is_directory(next, ec)) return NAVIGATE_NOT_FOUND;
+            c.path = std::move(next);
+            return NAVIGATE_SUCCESS;
+        }
+        auto child = c.inst ? c.inst->FindFirstChild(name) : nullptr;
+        if (!child) return NAVIGATE_NOT_FOUND;
+        c.inst = std::move(child);
+        return NAVIGATE_SUCCESS;
+    };
+
+    config->is_module_present = [](lua_State*, void* ctx) {
+        auto* self = static_cast<ModuleLoader*>(ctx);
+        const Cursor& c = self->cursor;
+        if (c.onDisk) return !ModuleFile(c.path).empty();
+        return c.inst && c.inst->Class == InstanceClass::ModuleScript;
+    };
+
+    config->get_chunkname = [](lua_State*, void* ctx, char* buffer, size_t size, size_t* sizeOut) {
+        auto* self = static_cast<ModuleLoader*>(ctx);
+        const Cursor& c = self->cursor;
+        if (c.onDisk) {
+            const std::string file = DiskKey(ModuleFile(c.path));
+            return WriteOut("@" + self->RegisterChunk(file, Requirer{{}, file}), buffer, size, sizeOut);
+        }
+        return WriteOut("@" + self->RegisterChunk(c.inst->GetFullName(), Requirer{c.inst, {}}), buffer, size, sizeOut);
+    };
+
+    // Load names double as cache keys, so a module is never loaded under two names
+    auto key = [](lua_State*, void* ctx, char* buffer, size_t size, size_t* sizeOut) {
+        auto* self = static_cast<ModuleLoader*>(ctx);
+        const Cursor& c = self->cursor;
+        const std::string k = c.onDisk ? DiskKey(ModuleFile(c.path)) : self->InstanceKey(c.inst);
+        return WriteOut(k, buffer, size, sizeOut);
+    };
+    config->get_loadname  = key;
+    config->get_cache_key = key;
+
+    // .luaurc aliases only exist on disk
+    config->is_config_present = [](lua_State*, void* ctx) {
+        auto* self = static_cast<ModuleLoader*>(ctx);
+        std::error_code ec;
+        return self->cursor.onDisk && fs::is_regular_file(self->cursor.path / ".luaurc", ec);
+    };
+    config->get_alias  = nullptr;
+    config->get_config = [](lua_State*, void* ctx, char* buffer, size_t size, size_t* sizeOut) {
+        auto* self = static_cast<ModuleLoader*>(ctx);
+        return WriteOut(fsys::ReadFileToString((self->cursor.path / ".luaurc").string()), buffer, size, sizeOut);
+    };
+
+    config->load = [](lua_State* L, void* ctx, const char*, const char* chunkname, const char* loadname) {
+        auto* self = static_cast<ModuleLoader*>(ctx);
+        const Cursor at = self->cursor; // requires inside the module move the cursor
+        return self->Run(L, at, chunkname, loadname);
+    };
+}
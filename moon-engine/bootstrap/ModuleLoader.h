@@ -0,0 +1,61 @@
+// ================== bootstrap/ModuleLoader.h ==================
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+struct lua_State;
+struct Instance;
+struct LuaSourceContainer;
+struct luarequire_Configuration;
+
+// require() for one VM, on top of Luau's require-by-string runtime (luau/Require).
+// String paths resolve from the requiring script: through the instance tree for scripts
+// that live in the place, through the filesystem for scripts loaded with --path (with
+// .luaurc aliases). A ModuleScript can also be passed directly, require(script.Parent.Util).
+// Every module compiles and runs once per VM; later requires get the cached return value.
+class ModuleLoader {
+public:
+    // Creates the VM's loader and registers the global 'require'. The loader is owned
+    // by the VM and goes away with it.
+    static void Open(lua_State* L);
+    static ModuleLoader* Get(lua_State* L);
+
+    // Chunk name (without '@') a script should be loaded under, so requires made
+    // from its code can find their way back to it. Same script, same name.
+    std::string ChunkNameFor(const std::shared_ptr<LuaSourceContainer>& src);
+
+private:
+    struct Requirer {
+        std::weak_ptr<Instance> inst;
+        std::filesystem::path   file;   // set when the code came from disk
+    };
+
+    // Where require-by-string currently points: an instance, or a module path on disk
+    // without its extension (foo -> foo.luau, foo.lua, foo/init.luau or foo/init.lua)
+    struct Cursor {
+        std::shared_ptr<Instance> inst;
+        std::filesystem::path     path;
+        bool                      onDisk = false;
+    };
+
+    std::string RegisterChunk(const std::string& base, const Requirer& r);
+    std::string InstanceKey(const std::shared_ptr<Instance>& inst);
+    static std::filesystem::path ModuleFile(const std::filesystem::path& path, int* matches = nullptr);
+
+    // Runs the module at 'at' and leaves its single return value on L
+    int Run(lua_State* L, const Cursor& at, const std::string& chunkname, const std::string& key);
+
+    static int  l_require(lua_State* L);
+    static void InitConfig(luarequire_Configuration* config);
+
+    Cursor cursor;
+    std::unordered_map<std::string, Requirer> chunks;    // chunk name -> code it belongs to
+    std::unordered_map<const Instance*, std::pair<std::weak_ptr<Instance>, std::string>> instanceKeys;
+    std::unordered_set<std::string> loading;             // cache keys mid-load, for cycles
+    uint64_t nextInstanceKey = 1;
+};
@@ -0,0 +1,303 @@
+#include "bootstrap/PartBounds.h"
+#include "bootstrap/instances/BasePart.h"
+#include <raymath.h>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+
+// ---------- SIMD ----------
+// Four rows per register. A lane passes a plane when its center is no further
+// behind it than the box (or sphere, whichever is tighter) reaches.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+namespace {
+using v4 = __m128;
+using m4 = __m128;
+inline v4   load(const float* f)     { return _mm_loadu_ps(f); }
+inline v4   splat(float s)           { return _mm_set1_ps(s); }
+inline v4   add(v4 a, v4 b)          { return _mm_add_ps(a, b); }
+inline v4   mul(v4 a, v4 b)          { return _mm_mul_ps(a, b); }
+inline v4   vmin(v4 a, v4 b)         { return _mm_min_ps(a, b); }
+inline v4   neg(v4 a)                { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+inline m4   all()                    { return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+inline m4   ge(v4 a, v4 b)           { return _mm_cmpge_ps(a, b); }
+inline m4   both(m4 a, m4 b)         { return _mm_and_ps(a, b); }
+inline int  bits(m4 m)               { return _mm_movemask_ps(m); }
+} // namespace
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+namespace {
+using v4 = float32x4_t;
+using m4 = uint32x4_t;
+inline v4   load(const float* f)     { return vld1q_f32(f); }
+inline v4   splat(float s)           { return vdupq_n_f32(s); }
+inline v4   add(v4 a, v4 b)          { return vaddq_f32(a, b); }
+inline v4   mul(v4 a, v4 b)          { return vmulq_f32(a, b); }
+inline v4   vmin(v4 a, v4 b)         { return vminq_f32(a, b); }
+inline v4   neg(v4 a)                { return vnegq_f32(a); }
+inline m4   all()                    { return vdupq_n_u32(0xFFFFFFFFu); }
+inline m4   ge(v4 a, v4 b)           { return vcgeq_f32(a, b); }
+inline m4   both(m4 a, m4 b)         { return vandq_u32(a, b); }
+inline int  bits(m4 m) {
+    return (int)(vgetq_lane_u32(m, 0) & 1u)        | (int)(vgetq_lane_u32(m, 1) & 1u) << 1
+         | (int)(vgetq_lane_u32(m, 2) & 1u) << 2   | (int)(vgetq_lane_u32(m, 3) & 1u) << 3;
+}
+} // namespace
+#else
+namespace {
+struct v4 { float f[4]; };
+struct m4 { bool b[4]; };
+inline v4   load(const float* f)     { return {{f[0], f[1], f[2], f[3]}}; }
+inline v4   splat(float s)           { return {{s, s, s, s}}; }
+inline v4   add(v4 a, v4 b)          { return {{a.f[0]+b.f[0], a.f[1]+b.f[1], a.f[2]+b.f[2], a.f[3]+b.f[3]}}; }
+inline v4   mul(v4 a, v4 b)          { return {{a.f[0]*b.f[0], a.f[1]*b.f[1], a.f[2]*b.f[2], a.f[3]*b.f[3]}}; }
+inline v4   vmin(v4 a, v4 b)         { v4 r; for (int i = 0; i < 4; ++i) r.f[i] = a.f[i] < b.f[i] ? a.f[i] : b.f[i]; return r; }
+inline v4   neg(v4 a)                { return {{-a.f[0], -a.f[1], -a.f[2], -a.f[3]}}; }
+inline m4   all()                    { return {{true, true, true, true}}; }
+inline m4   ge(v4 a, v4 b)           { m4 r; for (int i = 0; i < 4; ++i) r.b[i] = a.f[i] >= b.f[i]; return r; }
+inline m4   both(m4 a, m4 b)         { m4 r; for (int i = 0; i < 4; ++i) r.b[i] = a.b[i] && b.b[i]; return r; }
+inline int  bits(m4 m)               { return (int)m.b[0] | (int)m.b[1] << 1 | (int)m.b[2] << 2 | (int)m.b[3] << 3; }
+} // namespace
+#endif
+
+// ---------- cache maintenance ----------
+static const float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+void PartBounds::Add(BasePart& part) {
+    uint32_t row;
+    if (!freeRows.empty()) {
+        row = freeRows.back();
+        freeRows.pop_back();
+    } else {
+        row = (uint32_t)Size();
+        cx.push_back(kNaN); cy.push_back(0); cz.push_back(0);
+        ex.push_back(0); ey.push_back(0); ez.push_back(0);
+        radius.push_back(0);
+        xform.push_back(MatrixIdentity());
+        color.push_back(0);
+        owner.push_back(nullptr);
+        group.push_back(kNone); slot.push_back(kNone);
+    }
+    owner[row] = &part;
+    part.Proxy.cache = this;
+    part.Proxy.row = row;
+    part.Proxy.queued = false;
+    part.MarkRenderDirty();
+    ++version;
+}
+
+void PartBounds::Remove(BasePart& part) {
+    if (part.Proxy.cache != this) return;
+    const uint32_t row = part.Proxy.row;
+    Place(row, kNone);
+    owner[row] = nullptr;
+    cx[row] = kNaN;
+    freeRows.push_back(row);
+    Detach(part);
+    ++version;
+}
+
+void PartBounds::Detach(BasePart& part) {
+    part.Proxy.cache = nullptr;
+    part.Proxy.queued = false;
+}
+
+const std::vector<uint32_t>& PartBounds::Refresh() {
+    refreshed.clear();
+    for (uint32_t row : dirty) {
+        BasePart* p = row < Size() ? owner[row] : nullptr;
+        if (!p || !p->Proxy.queued) continue; // freed, or already refreshed this pass
+        p->Proxy.queued = false;
+
+        const CFrame& cf = p->CF;
+        const ::Vector3 size = p->Size;
+        const float hx = 0.5f * fabsf(size.x);
+        const float hy = 0.5f * fabsf(size.y);
+        const float hz = 0.5f * fabsf(size.z);
+        cx[row] = cf.p.x; cy[row] = cf.p.y; cz[row] = cf.p.z;
+        // |R| * half size: the axis-aligned box around the rotated one
+        ex[row] = fabsf(cf.r(0,0))*hx + fabsf(cf.r(0,1))*hy + fabsf(cf.r(0,2))*hz;
+        ey[row] = fabsf(cf.r(1,0))*hx + fabsf(cf.r(1,1))*hy + fabsf(cf.r(1,2))*hz;
+        ez[row] = fabsf(cf.r(2,0))*hx + fabsf(cf.r(2,1))*hy + fabsf(cf.r(2,2))*hz;
+        radius[row] = sqrtf(hx*hx + hy*hy + hz*hz);
+
+        // columns are R scaled by Size, then the translation
+        Matrix& m = xform[row];
+        m.m0 = cf.r(0,0)*size.x; m.m1 = cf.r(1,0)*size.x; m.m2  = cf.r(2,0)*size.x; m.m3  = 0.0f;
+        m.m4 = cf.r(0,1)*size.y; m.m5 = cf.r(1,1)*size.y; m.m6  = cf.r(2,1)*size.y; m.m7  = 0.0f;
+        m.m8 = cf.r(0,2)*size.z; m.m9 = cf.r(1,2)*size.z; m.m10 = cf.r(2,2)*size.z; m.m11 = 0.0f;
+        m.m12 = cf.p.x;          m.m13 = cf.p.y;          m.m14 = cf.p.z;           m.m15 = 1.0f;
+
+        auto byte = [](float v) { return (uint32_t)std::lroundf(std::clamp(v, 0.0f, 1.0f) * 255.0f); };
+        color[row] = byte(p->Color.r) | byte(p->Color.g) << 8 | byte(p->Color.b) << 16
+                   | byte(1.0f - p->Transparency) << 24;
+
+        if (group[row] != kNone) {
+            Group& g = groups[group[row]];
+            Touch(g, slot[row]);
+            Grow(g, row);
+            g.loose = true; // the old box may have been the one on the edge
+        }
+        refreshed.push_back(row);
+    }
+    dirty.clear();
+    if (!refreshed.empty()) ++version;
+    return refreshed;
+}
+
+// ---------- groups ----------
+uint32_t PartBounds::NewGroup() {
+    groups.emplace_back();
+    return (uint32_t)groups.size() - 1;
+}
+
+void PartBounds::Touch(Group& g, uint32_t s) {
+    if (g.dirtyLo == kNone || s < g.dirtyLo) g.dirtyLo = s;
+    if (s > g.dirtyHi) g.dirtyHi = s;
+}
+
+void PartBounds::Grow(Group& g, uint32_t row) {
+    const float c[3] = { cx[row], cy[row], cz[row] };
+    const float e[3] = { ex[row], ey[row], ez[row] };
+    for (int k = 0; k < 3; ++k) {
+        g.lo[k] = std::min(g.lo[k], c[k] - e[k]);
+        g.hi[k] = std::max(g.hi[k], c[k] + e[k]);
+    }
+}
+
+void PartBounds::Place(uint32_t row, uint32_t gi) {
+    const uint32_t old = group[row];
+    if (old == gi) return;
+
+    if (old != kNone) {
+        Group& g = groups[old];
+        const uint32_t s = slot[row];
+        const uint32_t last = (uint32_t)g.rows.size() - 1;
+        if (s != last) {
+            const uint32_t moved = g.rows[last];
+            g.rows[s] = moved;
+            slot[moved] = s;
+        }
+        Touch(g, s); // past the end when it was the last slot: only the count changes
+        g.rows.pop_back();
+        g.loose = true;
+    }
+    group[row] = gi;
+    slot[row] = kNone;
+
+    if (gi != kNone) {
+        Group& g = groups[gi];
+        if (g.rows.empty()) {
+            for (int k = 0; k < 3; ++k) { g.lo[k] = FLT_MAX; g.hi[k] = -FLT_MAX; }
+            g.loose = false;
+        }
+        slot[row] = (uint32_t)g.rows.size();
+        g.rows.push_back(row);
+        Touch(g, slot[row]);
+        Grow(g, row);
+    }
+}
+
+void PartBounds::FitBox(uint32_t gi) {
+    Group& g = groups[gi];
+    if (!g.loose) return;
+    g.loose = false;
+    for (int k = 0; k < 3; ++k) { g.lo[k] = FLT_MAX; g.hi[k] = -FLT_MAX; }
+    for (uint32_t row : g.rows) Grow(g, row);
+}
+
+// ---------- frustum ----------
+Frustum Frustum::FromMatrix(const Matrix& m) {
+    // Gribb/Hartmann: each plane is row 3 plus or minus row 0..2 of the matrix
+    const float r0[4] = { m.m0, m.m4, m.m8,  m.m12 };
+    const float r1[4] = { m.m1, m.m5, m.m9,  m.m13 };
+    const float r2[4] = { m.m2, m.m6, m.m10, m.m14 };
+    const float r3[4] = { m.m3, m.m7, m.m11, m.m15 };
+    const float* rows[3] = { r0, r1, r2 };
+
+    Frustum f{};
+    for (int i = 0; i < 6; ++i) {
+        const float* r = rows[i / 2];
+        const float s = (i & 1) ? -1.0f : 1.0f; // left/right, bottom/top, near/far
+        float p[4];
+        for (int k = 0; k < 4; ++k) p[k] = r3[k] + s * r[k];
+        const float len = sqrtf(p[0]*p[0] + p[1]*p[1] + p[2]*p[2]);
+        const float inv = len > 0.0f ? 1.0f / len : 0.0f;
+        f.a[i] = p[0]*inv; f.b[i] = p[1]*inv; f.c[i] = p[2]*inv; f.d[i] = p[3]*inv;
+    }
+    return f;
+}
+
+Frustum Frustum::FromCamera(const Camera3D& cam, float aspect, float nearD, float farD) {
+    // Same matrices BeginMode3D builds
+    const Matrix view = MatrixLookAt(cam.position, cam.target, cam.up);
+    Matrix proj;
+    if (cam.projection == CAMERA_ORTHOGRAPHIC) {
+        const double top = cam.fovy * 0.5;
+        const double right = top * aspect;
+        proj = MatrixOrtho(-right, right, -top, top, nearD, farD);
+    } else {
+        proj = MatrixPerspective(cam.fovy * DEG2RAD, aspect, nearD, farD);
+    }
+    Frustum f = FromMatrix(MatrixMultiply(view, proj));
+
+    // Near and far come out of w -/+ z, which cancels badly in float once far/near
+    // is large; rebuild them from the view direction instead
+    const Vector3 fwd = Vector3Normalize(Vector3Subtract(cam.target, cam.position));
+    const float depth = Vector3DotProduct(fwd, cam.position);
+    f.a[4] =  fwd.x; f.b[4] =  fwd.y; f.c[4] =  fwd.z; f.d[4] = -depth - nearD;
+    f.a[5] = -fwd.x; f.b[5] = -fwd.y; f.c[5] = -fwd.z; f.d[5] =  depth + farD;
+    return f;
+}
+
+bool Frustum::TestBox(const float lo[3], const float hi[3]) const {
+    const float mx = 0.5f*(lo[0]+hi[0]), my = 0.5f*(lo[1]+hi[1]), mz = 0.5f*(lo[2]+hi[2]);
+    const float hx = 0.5f*(hi[0]-lo[0]), hy = 0.5f*(hi[1]-lo[1]), hz = 0.5f*(hi[2]-lo[2]);
+    for (int k = 0; k < 6; ++k) {
+        const float dist = a[k]*mx + b[k]*my + c[k]*mz + d[k];
+        const float reach = fabsf(a[k])*hx + fabsf(b[k])*hy + fabsf(c[k])*hz;
+        if (dist < -reach) return false;
+    }
+    return true;
+}
+
+// ---------- culling ----------
+static inline bool CullOne(const PartBounds& b, const Frustum& f, size_t i) {
+    for (int k = 0; k < 6; ++k) {
+        const float dist = f.a[k]*b.cx[i] + f.b[k]*b.cy[i] + f.c[k]*b.cz[i] + f.d[k];
+        const float box = fabsf(f.a[k])*b.ex[i] + fabsf(f.b[k])*b.ey[i] + fabsf(f.c[k])*b.ez[i];
+        const float reach = box < b.radius[i] ? box : b.radius[i];
+        if (!(dist >= -reach)) return false;
+    }
+    return true;
+}
+
+size_t CullBounds(const PartBounds& b, const Frustum& f, uint8_t* visible) {
+    const size_t n = b.Size();
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const v4 x = load(&b.cx[i]), y = load(&b.cy[i]), z = load(&b.cz[i]);
+        const v4 hx = load(&b.ex[i]), hy = load(&b.ey[i]), hz = load(&b.ez[i]);
+        const v4 r = load(&b.radius[i]);
+        m4 in = all();
+        for (int k = 0; k < 6; ++k) {
+            const v4 dist = add(add(add(mul(splat(f.a[k]), x), mul(splat(f.b[k]), y)),
+                                    mul(splat(f.c[k]), z)), splat(f.d[k]));
+            const v4 box = add(add(mul(splat(fabsf(f.a[k])), hx), mul(splat(fabsf(f.b[k])), hy)),
+                               mul(splat(fabsf(f.c[k])), hz));
+            in = both(in, ge(dist, neg(vmin(box, r))));
+        }
+        const int mask = bits(in);
+        for (int l = 0; l < 4; ++l) {
+            visible[i + l] = (uint8_t)((mask >> l) & 1);
+            count += visible[i + l];
+        }
+    }
+    for (; i < n; ++i) {
+        visible[i] = CullOne(b, f, i) ? 1 : 0;
+        count += visible[i];
+    }
+    return count;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <raylib.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct BasePart;
+
+// Render proxies for every part in the Workspace, stored as parallel arrays so
+// culling and batching stream floats instead of chasing shared_ptr<BasePart>.
+// A part keeps the same row for as long as it is in the Workspace
+// (BasePart::Proxy); rows of removed parts are recycled by later adds.
+// Rows are refreshed lazily: code that writes a part's CF, Size, Color, Shape,
+// Transparency or CastShadow calls BasePart::MarkRenderDirty(), which queues the
+// row once.
+struct PartBounds {
+    static constexpr uint32_t kNone = 0xFFFFFFFFu;
+
+    std::vector<float> cx, cy, cz; // center; NaN on free rows so they never pass a cull
+    std::vector<float> ex, ey, ez; // half extents of the world-space box
+    std::vector<float> radius;     // bounding sphere radius
+    std::vector<Matrix> xform;     // instance matrix: scale by Size, rotate, translate
+    std::vector<uint32_t> color;   // RGBA8 (r in the low byte), alpha = 1 - Transparency
+    std::vector<BasePart*> owner;  // null on free rows
+
+    // Instancing groups. The renderer files rows into groups (one per draw batch);
+    // a group lists its rows by slot and remembers which slots changed since the
+    // renderer last uploaded it. Leaving a group swap-removes, so slots stay dense.
+    struct Group {
+        std::vector<uint32_t> rows;           // slot -> row
+        uint32_t dirtyLo = kNone, dirtyHi = 0; // changed slots, inclusive
+        float lo[3], hi[3];                   // box around the members; only grows until refitted
+        bool loose = false;                   // a member moved or left since the last FitBox
+
+        bool Dirty() const { return dirtyLo != kNone; }
+        void ClearDirty() { dirtyLo = kNone; dirtyHi = 0; }
+    };
+    std::vector<Group> groups;
+    std::vector<uint32_t> group, slot; // per row; kNone when ungrouped
+
+    size_t Size() const { return cx.size(); }
+    size_t LiveCount() const { return cx.size() - freeRows.size(); }
+    // Bumped whenever a row is added, removed or refreshed
+    uint64_t Version() const { return version; }
+
+    void Add(BasePart& part);
+    void Remove(BasePart& part);
+    void Detach(BasePart& part);                    // part outlives the cache
+    void MarkDirty(uint32_t row) { dirty.push_back(row); }
+
+    // Recompute every queued row; returns the rows that changed (valid until the next call)
+    const std::vector<uint32_t>& Refresh();
+
+    uint32_t NewGroup();
+    // File row under group g (kNone leaves its group); marks the touched slots dirty
+    void Place(uint32_t row, uint32_t g);
+    // Shrink a loose group's box back around its current members. The renderer calls it
+    // when it uploads the group, which every move or departure marks dirty.
+    void FitBox(uint32_t g);
+
+private:
+    void Touch(Group& g, uint32_t s);
+    void Grow(Group& g, uint32_t row);
+
+    std::vector<uint32_t> dirty;
+    std::vector<uint32_t> refreshed;
+    std::vector<uint32_t> freeRows;
+    uint64_t version = 0;
+};
+
+// Six inward-facing planes (a*x + b*y + c*z + d >= 0 inside), unit normals,
+// stored by component so four boxes are tested per plane at once
+struct Frustum {
+    float a[6], b[6], c[6], d[6];
+
+    // Planes of clip = viewProj * p, in raymath's column-major layout
+    static Frustum FromMatrix(const Matrix& viewProj);
+    static Frustum FromCamera(const Camera3D& cam, float aspect, float nearD, float farD);
+
+    // Axis-aligned box lo..hi touches the frustum
+    bool TestBox(const float lo[3], const float hi[3]) const;
+};
+
+// Writes 1 to visible[i] for every row whose box touches the frustum, 0 otherwise,
+// and returns how many rows are visible. visible must hold bounds.Size() bytes.
+size_t CullBounds(const PartBounds& bounds, const Frustum& frustum, uint8_t* visible);
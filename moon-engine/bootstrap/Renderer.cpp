@@ -13,7 +13,10 @@
 #include <cfloat>
 #include <unordered_map>
 #include <cstdint>
+#include <cstddef>
+#include <cstring>
 #include "bootstrap/Game.h"
+#include "bootstrap/PartBounds.h"
 #include "bootstrap/instances/InstanceTypes.h"
 #include "bootstrap/instances/BasePart.h"      // for CF
 #include "bootstrap/instances/MeshPart.h"      // for MeshPart
@@ -30,8 +33,7 @@ extern std::shared_ptr<Game> g_game;
 // i wished you could enjoy reading all the mess that i did here, have a good one!
 
 // ---------------- Tunables ----------------
-static float kMaxDrawDistance = 10000.0f;
-static float kFovPaddingDeg   = 20.0f;
+static float kMaxDrawDistance = 10000.0f; // far plane for culling (clamped to raylib's own far clip)
 
 // shadow parameter definitions
 static float kShadowMaxDistance = 300.0f;  // increased shadow distance
@@ -159,6 +161,7 @@ static int ui_splits=-1;
 static int ui_exposure=-1;
 static int ui_normalBias0=-1, ui_normalBias1=-1, ui_normalBias2=-1;
 static int ui_transition = -1;
+static int ui_instanceColor = -1; // attribute
 
 // ---------------- Shadowmap helpers ----------------
 static RenderTexture2D LoadShadowmapRenderTexture(int width, int height){
@@ -192,10 +195,9 @@ static void UnloadShadowmapRenderTexture(RenderTexture2D target){
 static inline float clampf(float x, float a, float b){ return x < a ? a : (x > b ? b : x); }
 
 static void CFrameToAxisAngle(const CFrame& cf, ::Vector3& axisOut, float& angleDegOut){
-    // Row-major 3x3
-    const float m00 = cf.R[0], m01 = cf.R[1], m02 = cf.R[2];
-    const float m10 = cf.R[3], m11 = cf.R[4], m12 = cf.R[5];
-    const float m20 = cf.R[6], m21 = cf.R[7], m22 = cf.R[8];
+    const float m00 = cf.r(0,0), m01 = cf.r(0,1), m02 = cf.r(0,2);
+    const float m10 = cf.r(1,0), m11 = cf.r(1,1), m12 = cf.r(1,2);
+    const float m20 = cf.r(2,0), m21 = cf.r(2,1), m22 = cf.r(2,2);
 
     const float trace = m00 + m11 + m22;
     float cosA = (trace - 1.0f)*0.5f;
@@ -425,6 +427,7 @@ static void EnsureShaders() {
         // in order for DrawMeshInstanced to pick up instanceTransform as the model matrix attribute,
         // assign its attribute location to SHADER_LOC_MATRIX_MODEL
         gLitShaderInst.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(gLitShaderInst, "instanceTransform");
+        ui_instanceColor = GetShaderLocationAttrib(gLitShaderInst, "instanceColor");
 
         // lighting (instanced)
         ui_viewPos   = GetShaderLocation(gLitShaderInst, "viewPos");
@@ -638,24 +641,340 @@ static Mesh GenerateMeshForShape(int shape) {
     }
 }
 
-// ---------------- Helper: Build instance matrix ----------------
-static inline Matrix BuildInstanceMatrix(const CFrame& cf, ::Vector3 size){
-    // CFrame::R is row-major 3x3 as used above
-    const float m00 = cf.R[0], m01 = cf.R[1], m02 = cf.R[2];
-    const float m10 = cf.R[3], m11 = cf.R[4], m12 = cf.R[5];
-    const float m20 = cf.R[6], m21 = cf.R[7], m22 = cf.R[8];
-    ::Vector3 t = cf.p.toRay();
-
-    Matrix M = {0};
-    // column 0 = Sx * R[:,0]
-    M.m0 = m00*size.x; M.m1 = m10*size.x; M.m2 = m20*size.x; M.m3 = 0.0f;
-    // column 1 = Sy * R[:,1]
-    M.m4 = m01*size.y; M.m5 = m11*size.y; M.m6 = m21*size.y; M.m7 = 0.0f;
-    // column 2 = Sz * R[:,2]
-    M.m8 = m02*size.z; M.m9 = m12*size.z; M.m10= m22*size.z; M.m11= 0.0f;
-    // column 3 = translation
-    M.m12 = t.x; M.m13 = t.y; M.m14 = t.z; M.m15 = 1.0f;
-    return M;
+// ---------------- Helper: cached shape meshes ----------------
+static Mesh& ShapeMesh(int shape) {
+    auto it = gShapeModels.find(shape);
+    if (it == gShapeModels.end()) {
+        // Create and cache the model for this shape
+        Model shapeModel = LoadModelFromMesh(GenerateMeshForShape(shape));
+        shapeModel.materials[0].shader = gLitShaderInst;
+        it = gShapeModels.emplace(shape, shapeModel).first;
+    }
+    return it->second.meshes[0];
+}
+
+// ---------------- Persistent instance buffers ----------------
+// Per-instance vertex data for the instanced lit shader
+struct InstanceData {
+    Matrix xform;           // instanceTransform
+    unsigned char color[4]; // instanceColor, normalized
+};
+static_assert(sizeof(InstanceData) == 17 * sizeof(float), "instance stride is assumed tight");
+
+// A GPU instance buffer that lives across frames. Callers write only the slots
+// that changed; the buffer is re-created (and must be refilled) when it grows.
+struct InstanceBuffer {
+    unsigned int vbo = 0;
+    int capacity = 0;
+    int count = 0; // instances drawn
+
+    // true when the buffer was re-created and its contents are gone
+    bool Reserve(int n) {
+        if (n <= capacity && vbo) return false;
+        Unload();
+        capacity = std::max({ n, capacity * 2, 256 });
+        vbo = rlLoadVertexBuffer(nullptr, capacity * (int)sizeof(InstanceData), true);
+        return true;
+    }
+    void Write(int first, const InstanceData* data, int n) {
+        rlUpdateVertexBuffer(vbo, data, n * (int)sizeof(InstanceData), first * (int)sizeof(InstanceData));
+    }
+    void Unload() {
+        if (vbo) rlUnloadVertexBuffer(vbo);
+        vbo = 0; capacity = 0; count = 0;
+    }
+};
+
+static inline void PackInstance(InstanceData& out, const Matrix& xform, uint32_t rgba) {
+    out.xform = xform;
+    // PartBounds packs r in the low byte
+    out.color[0] = (unsigned char)(rgba);       out.color[1] = (unsigned char)(rgba >> 8);
+    out.color[2] = (unsigned char)(rgba >> 16); out.color[3] = (unsigned char)(rgba >> 24);
+}
+
+// DrawMeshInstanced without the per-call buffer: binds buf as the instance
+// attributes of mesh's VAO, draws, then detaches them again so non-instanced
+// draws of the same mesh are unaffected. first/count pick a run of instances
+// (count < 0 draws to the end of the buffer).
+static void DrawInstances(const Mesh& mesh, const Material& mat, const InstanceBuffer& buf,
+                          int first = 0, int count = -1) {
+    if (count < 0) count = buf.count - first;
+    if (count <= 0 || !buf.vbo) return;
+    const Shader& sh = mat.shader;
+    const int xfLoc = sh.locs[SHADER_LOC_MATRIX_MODEL];
+    if (xfLoc < 0) return;
+
+    rlEnableShader(sh.id);
+    if (sh.locs[SHADER_LOC_COLOR_DIFFUSE] != -1) {
+        const Color c = mat.maps[MATERIAL_MAP_DIFFUSE].color;
+        const float tint[4] = { c.r/255.0f, c.g/255.0f, c.b/255.0f, c.a/255.0f };
+        rlSetUniform(sh.locs[SHADER_LOC_COLOR_DIFFUSE], tint, SHADER_UNIFORM_VEC4, 1);
+    }
+    const Matrix modelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+    rlSetUniformMatrix(sh.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(modelView, rlGetMatrixProjection()));
+
+    const unsigned int tex = mat.maps[MATERIAL_MAP_DIFFUSE].texture.id;
+    if (tex) {
+        int unit = 0;
+        rlActiveTextureSlot(0);
+        rlEnableTexture(tex);
+        rlSetUniform(sh.locs[SHADER_LOC_MAP_DIFFUSE], &unit, SHADER_UNIFORM_INT, 1);
+    }
+
+    const int base = first * (int)sizeof(InstanceData);
+    rlEnableVertexArray(mesh.vaoId);
+    rlEnableVertexBuffer(buf.vbo);
+    for (int i = 0; i < 4; i++) {
+        rlEnableVertexAttribute(xfLoc + i);
+        rlSetVertexAttribute(xfLoc + i, 4, RL_FLOAT, false, sizeof(InstanceData), base + i * (int)sizeof(Vector4));
+        rlSetVertexAttributeDivisor(xfLoc + i, 1);
+    }
+    if (ui_instanceColor >= 0) {
+        rlEnableVertexAttribute(ui_instanceColor);
+        rlSetVertexAttribute(ui_instanceColor, 4, RL_UNSIGNED_BYTE, true, sizeof(InstanceData), base + (int)offsetof(InstanceData, color));
+        rlSetVertexAttributeDivisor(ui_instanceColor, 1);
+    }
+
+    if (mesh.indices) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, count);
+    else rlDrawVertexArrayInstanced(0, mesh.vertexCount, count);
+
+    for (int i = 0; i < 4; i++) { rlSetVertexAttributeDivisor(xfLoc + i, 0); rlDisableVertexAttribute(xfLoc + i); }
+    if (ui_instanceColor >= 0) { rlSetVertexAttributeDivisor(ui_instanceColor, 0); rlDisableVertexAttribute(ui_instanceColor); }
+
+    if (tex) { rlActiveTextureSlot(0); rlDisableTexture(); }
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+    rlDisableShader();
+}
+
+// ---------------- Persistent opaque batches ----------------
+// Opaque parts are filed into PartBounds groups, one per (shape, world cell); each
+// group is one instanced draw whose GPU buffer persists across frames and only
+// receives the slots the group marked dirty. Cells keep a batch spatially tight
+// so it can be frustum-culled as a whole, and colors ride along per instance.
+// A group whose last member leaves gives its buffer back and its index is reused by
+// the next new (shape, cell), so the lists stay as long as the most groups live at once.
+static constexpr float kBatchCellSize = 256.0f;
+
+struct BatchKey {
+    int shape;
+    int x, y, z; // cell
+    bool operator==(const BatchKey& o) const { return shape == o.shape && x == o.x && y == o.y && z == o.z; }
+};
+struct BatchKeyHash {
+    size_t operator()(const BatchKey& k) const {
+        uint64_t h = (uint64_t)(uint32_t)k.x * 0x9E3779B97F4A7C15ull;
+        h ^= (uint64_t)(uint32_t)k.y * 0xC2B2AE3D27D4EB4Full + (h << 6) + (h >> 2);
+        h ^= (uint64_t)(uint32_t)k.z * 0x165667B19E3779F9ull + (h << 6) + (h >> 2);
+        return (size_t)(h ^ (uint64_t)k.shape);
+    }
+};
+struct PartBatch {
+    int shape;
+    BatchKey key;
+    InstanceBuffer gpu;
+};
+
+static const PartBounds* gBatchSource = nullptr;
+static std::vector<PartBatch> gBatches; // index = PartBounds group
+static std::unordered_map<BatchKey, uint32_t, BatchKeyHash> gBatchIndex;
+static std::vector<uint32_t> gFreeBatches; // emptied groups, reused before NewGroup
+
+static void FileIntoBatch(PartBounds& b, uint32_t row) {
+    const BasePart* p = b.owner[row];
+    uint32_t g = PartBounds::kNone;
+    // MeshParts draw their own model, and transparent parts are sorted every frame
+    if (p && p->Alive && p->Class != InstanceClass::MeshPart && p->Transparency <= 0.0f) {
+        const BatchKey key{ p->Shape,
+                            (int)floorf(b.cx[row] / kBatchCellSize),
+                            (int)floorf(b.cy[row] / kBatchCellSize),
+                            (int)floorf(b.cz[row] / kBatchCellSize) };
+        auto it = gBatchIndex.find(key);
+        if (it == gBatchIndex.end()) {
+            if (!gFreeBatches.empty()) {
+                g = gFreeBatches.back();
+                gFreeBatches.pop_back();
+                gBatches[g].shape = p->Shape;
+                gBatches[g].key = key;
+            } else {
+                g = b.NewGroup();
+                gBatches.push_back({ p->Shape, key, {} });
+            }
+            gBatchIndex.emplace(key, g);
+        } else {
+            g = it->second;
+        }
+    }
+    b.Place(row, g);
+}
+
+// Start over against a different bounds cache (new Workspace)
+static void ResetBatches(PartBounds& b) {
+    for (auto& batch : gBatches) batch.gpu.Unload();
+    gBatches.clear();
+    gBatchIndex.clear();
+    gFreeBatches.clear();
+    for (uint32_t row = 0; row < b.Size(); ++row) b.Place(row, PartBounds::kNone);
+    b.groups.clear();
+    gBatchSource = &b;
+    for (uint32_t row = 0; row < b.Size(); ++row) if (b.owner[row]) FileIntoBatch(b, row);
+}
+
+// Send every group's dirty slots; returns how many instances went to the GPU
+static size_t UploadBatches(PartBounds& b) {
+    static std::vector<InstanceData> scratch;
+    size_t sent = 0;
+    for (size_t gi = 0; gi < gBatches.size(); ++gi) {
+        PartBounds::Group& g = b.groups[gi];
+        if (!g.Dirty()) continue;
+        InstanceBuffer& gpu = gBatches[gi].gpu;
+        const uint32_t count = (uint32_t)g.rows.size();
+        if (count == 0) {
+            // last member left: free the buffer and retire the (shape, cell)
+            gpu.Unload();
+            gBatchIndex.erase(gBatches[gi].key);
+            gFreeBatches.push_back((uint32_t)gi);
+            g.ClearDirty();
+            continue;
+        }
+        b.FitBox((uint32_t)gi);
+        uint32_t lo = g.dirtyLo, hi = std::min(g.dirtyHi, count - 1);
+        if (gpu.Reserve((int)count)) { lo = 0; hi = count - 1; }
+        gpu.count = (int)count;
+        if (lo < count && lo <= hi) {
+            scratch.resize(hi - lo + 1);
+            for (uint32_t s = lo; s <= hi; ++s) {
+                const uint32_t row = g.rows[s];
+                PackInstance(scratch[s - lo], b.xform[row], b.color[row]);
+            }
+            gpu.Write((int)lo, scratch.data(), (int)scratch.size());
+            sent += scratch.size();
+        }
+        g.ClearDirty();
+    }
+    return sent;
+}
+
+// ---------------- Shadow casters ----------------
+// Each cascade keeps its own casters, bucketed by shape so Balls, Cylinders and
+// Wedges shadow with their own mesh, and culled against that cascade's light
+// frustum so a part is only rasterized into the cascades it overlaps. Lists are
+// rebuilt when the parts change or the cascade's light camera moves.
+static constexpr int kShapeCount = 5; // PartType 0..4
+
+struct ShadowCascade {
+    Frustum frustum{};          // light frustum the lists were culled against
+    uint64_t version = ~0ull;   // PartBounds version they were built from
+    InstanceBuffer byShape[kShapeCount];
+    size_t casters = 0;
+};
+static ShadowCascade gShadowCascades[3];
+
+// Returns how many instances went to the GPU
+static size_t BuildShadowCasters(ShadowCascade& sc, const PartBounds& b) {
+    static std::vector<uint8_t> inside;
+    static std::vector<InstanceData> byShape[kShapeCount];
+    inside.resize(b.Size());
+    CullBounds(b, sc.frustum, inside.data());
+    for (auto& list : byShape) list.clear();
+
+    for (size_t i = 0; i < b.Size(); ++i) {
+        if (!inside[i]) continue;
+        const BasePart* p = b.owner[i];
+        // Partly transparent parts still cast a solid shadow
+        if (!p || !p->Alive || !p->CastShadow || p->Transparency >= 1.0f) continue;
+        // MeshParts cast the box of their Size
+        int shape = p->Shape;
+        if (p->Class == InstanceClass::MeshPart || shape < 0 || shape >= kShapeCount) shape = 1;
+        byShape[shape].emplace_back();
+        PackInstance(byShape[shape].back(), b.xform[i], b.color[i]);
+    }
+
+    sc.casters = 0;
+    for (int s = 0; s < kShapeCount; ++s) {
+        const int n = (int)byShape[s].size();
+        if (n) {
+            sc.byShape[s].Reserve(n);
+            sc.byShape[s].Write(0, byShape[s].data(), n);
+        }
+        sc.byShape[s].count = n;
+        sc.casters += n;
+    }
+    return sc.casters;
+}
+
+static void ClearShadowCasters() {
+    for (auto& sc : gShadowCascades) {
+        for (auto& buf : sc.byShape) buf.count = 0;
+        sc.casters = 0;
+        sc.version = ~0ull;
+    }
+}
+
+// ---------------- Transparent parts ----------------
+// Visible transparent parts are sorted back to front on a 32-bit depth key and
+// packed into one instance buffer in that order. Consecutive parts of the same
+// shape form a run that is a single instanced draw; instances rasterize in
+// order, so blending stays back to front across and within runs.
+struct TransparentRun {
+    int shape;
+    int first, count; // instances in gTransparents
+};
+static InstanceBuffer gTransparents;
+static std::vector<TransparentRun> gTransparentRuns;
+
+// LSD radix sort on the high 32 bits of each item, one byte per pass; passes
+// where every item has the same byte are skipped
+static void RadixSortByKey(std::vector<uint64_t>& items, std::vector<uint64_t>& scratch) {
+    scratch.resize(items.size());
+    for (int shift = 32; shift < 64; shift += 8) {
+        size_t offsets[256] = {};
+        for (uint64_t v : items) ++offsets[(v >> shift) & 0xFF];
+        if (offsets[(items.empty() ? 0 : items[0] >> shift) & 0xFF] == items.size()) continue;
+        size_t sum = 0;
+        for (size_t& o : offsets) { const size_t n = o; o = sum; sum += n; }
+        for (uint64_t v : items) scratch[offsets[(v >> shift) & 0xFF]++] = v;
+        items.swap(scratch);
+    }
+}
+
+// Sort key for back-to-front order: squared distances are non-negative, so their
+// float bits order like the values; inverting them puts the farthest first
+static inline uint64_t TransparentKey(float dist2, uint32_t row) {
+    uint32_t bits;
+    std::memcpy(&bits, &dist2, sizeof bits);
+    return (uint64_t)~bits << 32 | row;
+}
+
+// Sorts keys (built with TransparentKey) and uploads them as runs; returns how
+// many instances went to the GPU
+static size_t BuildTransparentRuns(const PartBounds& b, std::vector<uint64_t>& keys) {
+    static std::vector<uint64_t> scratch;
+    static std::vector<InstanceData> instances;
+    RadixSortByKey(keys, scratch);
+
+    gTransparentRuns.clear();
+    instances.resize(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        const uint32_t row = (uint32_t)keys[i];
+        const BasePart* p = b.owner[row];
+        // MeshParts draw the box of their Size here, as in the shadow pass
+        int shape = p->Shape;
+        if (p->Class == InstanceClass::MeshPart || shape < 0 || shape >= kShapeCount) shape = 1;
+        if (gTransparentRuns.empty() || gTransparentRuns.back().shape != shape)
+            gTransparentRuns.push_back({ shape, (int)i, 0 });
+        ++gTransparentRuns.back().count;
+        PackInstance(instances[i], b.xform[row], b.color[row]);
+    }
+
+    const int n = (int)instances.size();
+    if (n) {
+        gTransparents.Reserve(n);
+        gTransparents.Write(0, instances.data(), n);
+    }
+    gTransparents.count = n;
+    return (size_t)n;
 }
 
 // ---------------- Main render ----------------
@@ -674,15 +993,11 @@ void RenderFrame(Camera3D& camera) {
 
     EnsureShaders();
 
-    // Camera + culling
+    // Camera + culling: the same planes BeginMode3D will project with
     const Vector3 camPos = camera.position;
-    Vector3 camDir = Vector3Normalize(Vector3Subtract(camera.target, camPos));
-    const float maxDistSq = kMaxDrawDistance * kMaxDrawDistance;
-    const float vFov = camera.fovy * (PI/180.0f);
     const float aspect = (float)GetScreenWidth()/(float)GetScreenHeight();
-    const float hFov = 2.0f * atanf(tanf(vFov*0.5f)*aspect);
-    const float halfCone = 0.5f * ((hFov>vFov)?hFov:vFov) + kFovPaddingDeg*(PI/180.0f);
-    const float cosHalf2 = cosf(halfCone)*cosf(halfCone); // kept for reference
+    const float cullFar = fminf(kMaxDrawDistance, (float)rlGetCullDistanceFar());
+    const Frustum viewFrustum = Frustum::FromCamera(camera, aspect, (float)rlGetCullDistanceNear(), cullFar);
 
     // Get lighting values from service (with fallbacks to constants)
     auto lightingService = std::dynamic_pointer_cast<Lighting>(Service::Get("Lighting"));
@@ -706,38 +1021,61 @@ void RenderFrame(Camera3D& camera) {
     float aoStr     = 0.9f; // Increased AO strength for more visible effect
     float groundY   = 0.5f;
 
-    // Gather parts
+    // Gather parts. The lists below persist across frames and are rebuilt only when
+    // a part changed or the camera moved, so a static scene does no per-part work.
     auto ws = g_game ? g_game->workspace : nullptr;
-    struct TItem { std::shared_ptr<BasePart> p; float dist2; float alpha; };
-    std::vector<std::shared_ptr<BasePart>> opaques;
-    std::vector<TItem> transparents;
+    static std::vector<uint64_t> transparentKeys; // visible, see TransparentKey
+    static std::vector<MeshPart*> meshParts;      // visible
+    static std::vector<uint8_t> visible;     // per ws->bounds row
+    static size_t visibleCount = 0, opaqueCount = 0;
+    static Frustum lastFrustum{};
+    static uint64_t lastVersion = ~0ull;
+    bool sceneChanged = false;
+    size_t uploadedInstances = 0;
 
     if (ws) {
-        for (const auto& p : ws->parts) {
-            if (!p || !p->Alive) continue;
-
-            // CF position
-            Vector3 pos = p->CF.p.toRay();
-            Vector3 delta = Vector3Subtract(pos, camPos);
-            float d2 = LenSq(delta);
-            if (d2 > maxDistSq) continue;
-
-            float dist = sqrtf(d2);
-            float cosTheta = Vector3DotProduct(camDir, delta) / (dist > 0 ? dist : 1.0f);
-
-            // size-based bounding sphere radius
-            float radius = 0.5f * Vector3Length(p->Size);
-
-            // allow hit if center is inside cone OR sphere overlaps cone boundary
-            float angleLimit = cosf(halfCone);
-            // if (cosTheta < angleLimit && dist * 0.5f > radius) continue;
-
-            float t = Clamp(p->Transparency, 0.0f, 1.0f);
-            float a = 1.0f - t;
-            if (a <= 0.0f) continue;
-            if (a >= 1.0f) opaques.push_back(p);
-            else transparents.push_back({p, d2, a});
+        PartBounds& bounds = ws->bounds;
+        const auto& refreshed = bounds.Refresh();
+        if (gBatchSource != &bounds || bounds.groups.size() != gBatches.size()) ResetBatches(bounds);
+        else for (uint32_t row : refreshed) FileIntoBatch(bounds, row);
+        uploadedInstances = UploadBatches(bounds);
+
+        sceneChanged = bounds.Version() != lastVersion
+                    || std::memcmp(&viewFrustum, &lastFrustum, sizeof(Frustum)) != 0;
+        if (sceneChanged) {
+            lastVersion = bounds.Version();
+            lastFrustum = viewFrustum;
+            visible.resize(bounds.Size());
+            visibleCount = CullBounds(bounds, viewFrustum, visible.data());
+
+            transparentKeys.clear();
+            meshParts.clear();
+            opaqueCount = 0;
+            for (size_t i = 0; i < bounds.Size(); ++i) {
+                if (!visible[i]) continue;
+                BasePart* p = bounds.owner[i];
+                if (!p || !p->Alive) continue;
+
+                float t = Clamp(p->Transparency, 0.0f, 1.0f);
+                float a = 1.0f - t;
+                if (a <= 0.0f) continue;
+                if (a < 1.0f) {
+                    const float dx = bounds.cx[i] - camPos.x, dy = bounds.cy[i] - camPos.y, dz = bounds.cz[i] - camPos.z;
+                    transparentKeys.push_back(TransparentKey(dx*dx + dy*dy + dz*dz, (uint32_t)i));
+                    continue;
+                }
+                ++opaqueCount;
+                if (p->Class == InstanceClass::MeshPart) meshParts.push_back(static_cast<MeshPart*>(p));
+            }
+            uploadedInstances += BuildTransparentRuns(bounds, transparentKeys);
         }
+    } else if (lastVersion != ~0ull) {
+        transparentKeys.clear();
+        gTransparentRuns.clear();
+        gTransparents.count = 0;
+        meshParts.clear();
+        visibleCount = opaqueCount = 0;
+        lastVersion = ~0ull;
     }
 
     // ---------------- Shadow pass (3 cascades) ----------------
@@ -767,27 +1105,22 @@ void RenderFrame(Camera3D& camera) {
         nearD = farD;
     }
 
-    // Build instance transforms for shadow casters (include opaques and transparents)
-    // Improved culling inspired by Raylib example - only cast shadows from nearby objects
-    std::vector<Matrix> shadowXforms;
-    shadowXforms.reserve(opaques.size() + transparents.size());
-    
-    float shadowCullDistSq = kShadowMaxDistance * kShadowMaxDistance;
-    for (auto& p : opaques) {
-        Vector3 pos = p->CF.p.toRay();
-        Vector3 delta = Vector3Subtract(pos, camPos);
-        float d2 = LenSq(delta);
-        if (d2 <= shadowCullDistSq) { // Only cast shadows from objects within shadow distance
-            shadowXforms.push_back(BuildInstanceMatrix(p->CF, p->Size));
-        }
-    }
-    for (auto& it : transparents) {
-        Vector3 pos = it.p->CF.p.toRay();
-        Vector3 delta = Vector3Subtract(pos, camPos);
-        float d2 = LenSq(delta);
-        if (d2 <= shadowCullDistSq) { // Only cast shadows from objects within shadow distance
-            shadowXforms.push_back(BuildInstanceMatrix(it.p->CF, it.p->Size));
+    // Shadow casters, per cascade. The light frustum is built the way BeginMode3D
+    // will build it for the shadow map (square target, rlgl's clip distances).
+    if (ws && kEnableShadows) {
+        const PartBounds& bounds = ws->bounds;
+        for (int i=0;i<3;i++){
+            ShadowCascade& sc = gShadowCascades[i];
+            const float aspectRT = (float)gShadowMapCSM[i].texture.width / (float)gShadowMapCSM[i].texture.height;
+            const Frustum lightFrustum = Frustum::FromCamera(lightCam[i], aspectRT,
+                (float)rlGetCullDistanceNear(), (float)rlGetCullDistanceFar());
+            if (sc.version == bounds.Version() && std::memcmp(&lightFrustum, &sc.frustum, sizeof(Frustum)) == 0) continue;
+            sc.frustum = lightFrustum;
+            sc.version = bounds.Version();
+            uploadedInstances += BuildShadowCasters(sc, bounds);
         }
+    } else {
+        ClearShadowCasters();
     }
 
     // Only render shadows if enabled (inspired by Raylib example)
@@ -806,12 +1139,13 @@ void RenderFrame(Camera3D& camera) {
                     rlDisableBackfaceCulling();
 
                     // Cast shadows from both opaque and transparent geometry (as solid)
-                    if (!shadowXforms.empty()) {
+                    if (gShadowCascades[i].casters > 0) {
                         // color doesn't matter; depth-only framebuffer will use depth
                         // ensure instanced material shader is active for drawing instanced meshes
                         gPartMatInst.shader = gLitShaderInst;
                         gPartMatInst.maps[MATERIAL_MAP_DIFFUSE].color = WHITE;
-                        DrawMeshInstanced(gPartModel.meshes[0], gPartMatInst, shadowXforms.data(), (int)shadowXforms.size());
+                        for (int s = 0; s < kShapeCount; ++s)
+                            DrawInstances(ShapeMesh(s), gPartMatInst, gShadowCascades[i].byShape[s]);
                     }
 
                     // re-enable culling to previous state
@@ -953,82 +1287,24 @@ void RenderFrame(Camera3D& camera) {
     SetPerFrame(gLitShader, false);
     SetPerFrame(gLitShaderInst, true);
 
-    // --- Separate MeshParts from regular Parts ---
-    std::vector<std::shared_ptr<BasePart>> regularParts;
-    std::vector<std::shared_ptr<MeshPart>> meshParts;
-    
-    
-    for (auto& p : opaques) {
-        // Check if this is a MeshPart
-        auto meshPart = std::dynamic_pointer_cast<MeshPart>(p);
-        if (meshPart) {
-            meshParts.push_back(meshPart);
-        } else {
-            regularParts.push_back(p);
-        }
-    }
-    
-    // --- Regular Parts: batch by color AND shape -> instanced draws ---
-    struct BatchKey {
-        uint32_t color;
-        int shape;
-        
-        bool operator==(const BatchKey& other) const {
-            return color == other.color && shape == other.shape;
-        }
-    };
-    
-    struct BatchKeyHash {
-        std::size_t operator()(const BatchKey& k) const {
-            return std::hash<uint32_t>()(k.color) ^ (std::hash<int>()(k.shape) << 1);
-        }
-    };
-    
-    std::unordered_map<BatchKey, std::vector<Matrix>, BatchKeyHash> batches;
-    batches.reserve(64);
-
-    auto pack = [](unsigned r,unsigned g,unsigned b,unsigned a)->uint32_t{
-        return (r<<24) | (g<<16) | (b<<8) | a;
-    };
-
-    for (auto& p : regularParts) {
-        Color c = ToRaylibColor(p->Color, 1.0f);
-        uint32_t colorKey = pack(c.r,c.g,c.b,c.a);
-        BatchKey key = {colorKey, p->Shape};
-        batches[key].push_back(BuildInstanceMatrix(p->CF, p->Size));
-    }
-
-    // Use instanced material/shader for regular part batches
-    if (!batches.empty()) {
-        // Ensure instanced material uses our instanced shader
+    // --- Regular Parts: persistent instanced batches, culled a batch at a time ---
+    size_t batchesDrawn = 0;
+    if (ws) {
+        // Ensure instanced material uses our instanced shader; colors come per instance
         gPartMatInst.shader = gLitShaderInst;
-
-        for (auto& kv : batches) {
-            auto &xforms = kv.second;
-            if (xforms.empty()) continue;
-            
-            BatchKey key = kv.first;
-            Color c = { (unsigned char)(key.color>>24), (unsigned char)(key.color>>16), 
-                       (unsigned char)(key.color>>8), (unsigned char)(key.color&0xFF) };
-            gPartMatInst.maps[MATERIAL_MAP_DIFFUSE].color = c;
-            
-            // Get or create the appropriate mesh for this shape
-            Mesh* meshToUse = nullptr;
-            if (gShapeModels.find(key.shape) == gShapeModels.end()) {
-                // Create and cache the model for this shape
-                Mesh shapeMesh = GenerateMeshForShape(key.shape);
-                Model shapeModel = LoadModelFromMesh(shapeMesh);
-                shapeModel.materials[0].shader = gLitShaderInst;
-                gShapeModels[key.shape] = shapeModel;
-            }
-            meshToUse = &gShapeModels[key.shape].meshes[0];
-            
-            DrawMeshInstanced(*meshToUse, gPartMatInst, xforms.data(), (int)xforms.size());
+        gPartMatInst.maps[MATERIAL_MAP_DIFFUSE].color = WHITE;
+
+        const PartBounds& bounds = ws->bounds;
+        for (size_t gi = 0; gi < gBatches.size(); ++gi) {
+            const PartBounds::Group& g = bounds.groups[gi];
+            if (g.rows.empty() || !viewFrustum.TestBox(g.lo, g.hi)) continue;
+            DrawInstances(ShapeMesh(gBatches[gi].shape), gPartMatInst, gBatches[gi].gpu);
+            ++batchesDrawn;
         }
     }
 
     // --- MeshParts: render individually with custom meshes ---
-    for (auto& meshPart : meshParts) {
+    for (MeshPart* meshPart : meshParts) {
         Color c = ToRaylibColor(meshPart->Color, 1.0f);
         Vector3 pos = meshPart->CF.p.toRay();
         Vector3 axis; float angleDeg;
@@ -1082,18 +1358,14 @@ void RenderFrame(Camera3D& camera) {
         EndShaderMode();
     }
 
-    // Transparencies (sorted back-to-front)
-    std::sort(transparents.begin(), transparents.end(),
-              [](const TItem& A, const TItem& B){ return A.dist2 > B.dist2; });
+    // Transparencies: runs of one shape, sorted back-to-front when the lists were
+    // built; color and alpha come per instance
     BeginBlendMode(BLEND_ALPHA);
     rlDisableDepthMask();
-    for (auto& it : transparents) {
-        Color c = ToRaylibColor(it.p->Color, it.alpha);
-        Vector3 pos = it.p->CF.p.toRay();
-        Vector3 axis; float angleDeg;
-        CFrameToAxisAngle(it.p->CF, axis, angleDeg);
-        DrawModelEx(gPartModel, pos, axis, angleDeg, it.p->Size, c);
-    }
+    gPartMatInst.shader = gLitShaderInst;
+    gPartMatInst.maps[MATERIAL_MAP_DIFFUSE].color = WHITE;
+    for (const TransparentRun& run : gTransparentRuns)
+        DrawInstances(ShapeMesh(run.shape), gPartMatInst, gTransparents, run.first, run.count);
     rlEnableDepthMask();
     EndBlendMode();
 
@@ -1112,6 +1384,30 @@ void RenderFrame(Camera3D& camera) {
         DrawText(TextFormat("Cascades: %d", kNumCascades), 10, 125, 16, WHITE);
         DrawText("F1: Toggle Debug | F2: Toggle Shadows", 10, 150, 14, GRAY);
         DrawText("[ ]: Decrease Bias | ] : Increase Bias", 10, 170, 14, GRAY);
+
+        // Lua GC pacer telemetry
+        if (g_game && g_game->luaScheduler) {
+            const auto& gc = g_game->luaScheduler->GetGcStats();
+            DrawText(TextFormat("Lua heap: %.1f MB | alloc %.0f KB/s", gc.heapBytes / (1024.0 * 1024.0), gc.allocKBps), 10, 195, 16, WHITE);
+            DrawText(TextFormat("GC step: %.2f ms (max %.2f) | cycles %llu | backoffs %llu",
+                                gc.lastStepMs, gc.maxStepMs,
+                                (unsigned long long)gc.pauses, (unsigned long long)gc.backoffs), 10, 215, 16, WHITE);
+            const auto& pool = g_game->luaScheduler->GetThreadPoolStats();
+            DrawText(TextFormat("Listener thread pool: %.1f%% hits | %zu idle | %u new this frame",
+                                pool.HitRate() * 100.0, pool.idle, pool.creationsLastFrame), 10, 235, 16, WHITE);
+            const auto conns = g_game->luaScheduler->GetConnectionReport();
+            DrawText(TextFormat("Connections: %zu owned | %zu unowned | %zu orphaned",
+                                conns.owned, conns.unowned, conns.orphaned), 10, 255, 16,
+                     conns.orphaned ? ORANGE : WHITE);
+        }
+        const size_t totalParts = ws ? ws->parts.size() : 0;
+        DrawText(TextFormat("Culling: %zu / %zu parts visible | %zu opaque, %zu transparent",
+                            visibleCount, totalParts, opaqueCount, transparentKeys.size()), 10, 275, 16, WHITE);
+        DrawText(TextFormat("Batches: %zu / %zu drawn | %zu transparent runs | %zu instances uploaded",
+                            batchesDrawn, gBatches.size() - gFreeBatches.size(), gTransparentRuns.size(), uploadedInstances), 10, 295, 16, WHITE);
+        DrawText(TextFormat("Shadow casters: %zu / %zu / %zu (near / mid / far cascade)",
+                            gShadowCascades[0].casters, gShadowCascades[1].casters, gShadowCascades[2].casters),
+                 10, 315, 16, WHITE);
     } else {
         DrawText("Press F1 for shadow debug info", 10, 40, 14, GRAY);
     }
@@ -1131,6 +1427,13 @@ void ShutdownRendererShadowResources(){
     if (gSkyModel.meshCount) { UnloadModel(gSkyModel); gSkyModel = {0}; }
     if (gPartModel.meshCount){ UnloadModel(gPartModel); gPartModel = {0}; }
     if (gPartMatInst.shader.id){ UnloadMaterial(gPartMatInst); gPartMatInst = {0}; }
+    for (auto& batch : gBatches) batch.gpu.Unload();
+    gBatches.clear(); gBatchIndex.clear(); gFreeBatches.clear(); gBatchSource = nullptr;
+    for (auto& sc : gShadowCascades) {
+        for (auto& buf : sc.byShape) buf.Unload();
+        sc.casters = 0; sc.version = ~0ull;
+    }
+    gTransparents.Unload(); gTransparentRuns.clear();
     if (gSkyShader.id) { UnloadShader(gSkyShader); gSkyShader = {0}; }
     if (gLitShaderInst.id){ UnloadShader(gLitShaderInst); gLitShaderInst = {0}; }
     if (gLitShader.id) { UnloadShader(gLitShader); gLitShader = {0}; }
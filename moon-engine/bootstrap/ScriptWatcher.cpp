@@ -0,0 +1,113 @@
+// ================== bootstrap/ScriptWatcher.cpp ==================
+#include "bootstrap/ScriptWatcher.h"
+#include "bootstrap/EngineClock.h"
+#include "bootstrap/LuaScheduler.h"
+#include "bootstrap/instances/BaseScript.h"
+#include "core/logging/Logging.h"
+#include "subsystems/filesystem/FileSystem.h"
+
+#include <cstdlib>
+
+// Luau
+#include "luacode.h"
+
+namespace fs = std::filesystem;
+
+static bool WriteTime(const fs::path& p, fs::file_time_type& out) {
+    std::error_code ec;
+    out = fs::last_write_time(p, ec);
+    return !ec;
+}
+
+static bool Stat(const fs::path& p, fs::file_time_type& mtime, std::uintmax_t& size) {
+    std::error_code ec;
+    size = fs::file_size(p, ec);
+    return !ec && WriteTime(p, mtime);
+}
+
+void ScriptWatcher::WatchFile(const fs::path& file, const std::shared_ptr<BaseScript>& script) {
+    if (!script) return;
+    Entry e;
+    e.script = script;
+    Stat(file, e.mtime, e.size);
+    files[file.lexically_normal().string()] = e;
+}
+
+void ScriptWatcher::WatchDirectory(const fs::path& dir) {
+    dirs.push_back(dir);
+}
+
+void ScriptWatcher::Poll(double wallNow) {
+    if (wallNow < nextPoll) return;
+    nextPoll = wallNow + pollIntervalSeconds;
+
+    for (auto it = files.begin(); it != files.end();) {
+        if (it->second.script.expired()) { it = files.erase(it); continue; }
+
+        // An editor may still be writing: a change is only reloaded once the write time
+        // and size have held for a whole poll, and a failed read is retried next poll
+        Entry& e = it->second;
+        fs::file_time_type t;
+        std::uintmax_t size = 0;
+        if (Stat(it->first, t, size)) {
+            if (t != e.mtime || size != e.size) {
+                e.mtime = t;
+                e.size = size;
+                e.pending = true;
+            } else if (e.pending && Reload(it->first, e)) {
+                e.pending = false;
+            }
+        }
+        ++it;
+    }
+
+    // new scripts dropped into a watched folder
+    for (const auto& dir : dirs) {
+        std::error_code ec;
+        for (auto& entry : fs::directory_iterator(dir, ec)) {
+            if (!entry.is_regular_file() || entry.path().extension() != ".lua") continue;
+            const std::string key = entry.path().lexically_normal().string();
+            if (files.count(key)) continue;
+
+            auto script = loadNew ? loadNew(entry.path().stem().string(), key) : nullptr;
+            if (script) {
+                WatchFile(entry.path(), script);
+                LOGI("Hot reload: picked up new script %s", key.c_str());
+            }
+        }
+    }
+}
+
+bool ScriptWatcher::Reload(const std::string& path, Entry& e) {
+    auto script = e.script.lock();
+    if (!script) return true;
+
+    // ReadFileToString gives "" on failure (or mid-save truncation): try again next poll
+    std::string src = fsys::ReadFileToString(path);
+    if (src.empty()) return false;
+    if (src == script->GetSource()) return true; // touched, not edited
+
+    const double start = EngineClock::Wall();
+
+    // Only tear the running version down once the new one is known to compile; the
+    // bytecode is then handed to the scheduler instead of compiling it twice
+    size_t bcSize = 0;
+    lua_CompileOptions opts = LuaScheduler::CompileOptions();
+    char* compiled = luau_compile(src.data(), src.size(), &opts, &bcSize);
+    const bool ok = compiled && bcSize > 0 && compiled[0] != 0;
+    if (!ok) {
+        LOGE("Hot reload: %s does not compile, keeping the running version: %s",
+             path.c_str(), (compiled && bcSize > 1) ? std::string(compiled + 1, bcSize - 1).c_str() : "?");
+        free(compiled);
+        return true;
+    }
+    std::string bytecode(compiled, bcSize);
+    free(compiled);
+
+    script->Stop();
+    script->SetSource(std::move(src));
+    script->ScheduleCompiled(std::move(bytecode));
+
+    LOGI("Hot reload: %s reloaded in %.2f ms", path.c_str(), (EngineClock::Wall() - start) * 1000.0);
+    return true;
+}
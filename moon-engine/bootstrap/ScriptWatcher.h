@@ -0,0 +1,50 @@
+// ================== bootstrap/ScriptWatcher.h ==================
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct BaseScript;
+
+// Hot reload for --path scripts. Polls the watched files' write times and sizes and,
+// once a change has held still for one poll, recompiles only that file: the old script is torn down through StopScript
+// (coroutine and the tasks it spawned) and the new source is scheduled in its place.
+// A file that no longer compiles is reported and the running version is kept.
+// Teardown finds what the old version owns by its memory category, so a script that
+// ran while categories were exhausted (category 0, shared with the engine) keeps its
+// tasks and connections across a reload.
+class ScriptWatcher {
+public:
+    using Loader = std::shared_ptr<BaseScript> (*)(const std::string& name, const std::string& path);
+
+    explicit ScriptWatcher(Loader loadNew) : loadNew(loadNew) {}
+
+    void WatchFile(const std::filesystem::path& file, const std::shared_ptr<BaseScript>& script);
+    // New .lua files that appear in 'dir' are loaded through the Loader
+    void WatchDirectory(const std::filesystem::path& dir);
+
+    // Cheap to call every frame; only touches the filesystem every pollIntervalSeconds.
+    void Poll(double wallNow);
+
+    double pollIntervalSeconds = 0.25;
+
+private:
+    struct Entry {
+        std::weak_ptr<BaseScript>       script;
+        std::filesystem::file_time_type mtime{};
+        std::uintmax_t                  size = 0;
+        bool                            pending = false; // changed, waiting for a stable poll
+    };
+
+    // False when the file could not be read whole yet; Poll retries it next time
+    bool Reload(const std::string& path, Entry& e);
+
+    Loader                                 loadNew;
+    std::unordered_map<std::string, Entry> files;
+    std::vector<std::filesystem::path>     dirs;
+    double                                 nextPoll = 0.0;
+};
@@ -6,6 +6,9 @@
 #include "ScriptingAPI.h"
 #include "bootstrap/Instance.h"
 #include "Game.h"
+#include "bootstrap/LuaScheduler.h"
+#include "bootstrap/EngineClock.h"
+#include "bootstrap/ModuleLoader.h"
 
 // Raylib
 #include <raylib.h>
@@ -37,7 +40,6 @@
 
 // Forward declarations
 struct Script;
-static void RegisterEnumGlobal(lua_State* L);
 
 // --- Signal glue (drop-in) ---
 #include "bootstrap/signals/Signal.h"   // RTScriptSignal
@@ -46,10 +48,10 @@ struct LuaSignalUD { std::shared_ptr<RTScriptSignal> sig; };
 struct LuaConnUD   { std::shared_ptr<RTScriptSignal> sig; size_t id{0}; };
 
 static LuaSignalUD* checkSignal(lua_State* L, int idx) {
-    return static_cast<LuaSignalUD*>(luaL_checkudata(L, idx, "Librebox.Signal"));
+    return static_cast<LuaSignalUD*>(lb::check_tagged(L, idx, lb::UserdataTag::Signal, "RBXScriptSignal"));
 }
 static LuaConnUD* checkConn(lua_State* L, int idx) {
-    return static_cast<LuaConnUD*>(luaL_checkudata(L, idx, "Librebox.Connection"));
+    return static_cast<LuaConnUD*>(lb::check_tagged(L, idx, lb::UserdataTag::Connection, "RBXScriptConnection"));
 }
 
 // Connection methods
@@ -87,6 +89,8 @@ static void ensure_connection_meta(lua_State* L){
         lua_setfield(L, -2, "__methods");
         lua_pushcfunction(L, l_conn_index, "__index"); lua_setfield(L, -2, "__index");
         lua_pushcfunction(L, l_conn_gc,    "__gc");    lua_setfield(L, -2, "__gc");
+        lua_pushstring(L, "RBXScriptConnection");     lua_setfield(L, -2, "__type");
+        lb::set_tag_metatable(L, lb::UserdataTag::Connection);
     }
     lua_pop(L, 1);
 }
@@ -98,10 +102,8 @@ static int l_signal_connect(lua_State* L){
     lua_remove(L, 1);                 // remove 'self'; function shifts to index 1
     size_t id = s->sig->Connect(L, /*once*/false, /*parallel*/false);
 
-    void* mem = lua_newuserdata(L, sizeof(LuaConnUD));
+    void* mem = lb::new_tagged(L, sizeof(LuaConnUD), lb::UserdataTag::Connection);
     new (mem) LuaConnUD{ s->sig, id };
-    luaL_getmetatable(L, "Librebox.Connection");
-    lua_setmetatable(L, -2);
     return 1;
 }
 
@@ -111,10 +113,8 @@ static int l_signal_once(lua_State* L){
     lua_remove(L, 1);                 // remove 'self'; function now at index 1
     size_t id = s->sig->Connect(L, /*once*/true, /*parallel*/false);
 
-    void* mem = lua_newuserdata(L, sizeof(LuaConnUD));
+    void* mem = lb::new_tagged(L, sizeof(LuaConnUD), lb::UserdataTag::Connection);
     new (mem) LuaConnUD{ s->sig, id };
-    luaL_getmetatable(L, "Librebox.Connection");
-    lua_setmetatable(L, -2);
     return 1;
 }
 
@@ -156,6 +156,10 @@ static void ensure_signal_meta(lua_State* L){
         // new __tostring
         lua_pushcfunction(L, l_signal_tostring, "tostring");
         lua_setfield(L, -2, "__tostring");
+
+        lua_pushstring(L, "RBXScriptSignal");
+        lua_setfield(L, -2, "__type");
+        lb::set_tag_metatable(L, lb::UserdataTag::Signal);
     }
     lua_pop(L, 1);
     ensure_connection_meta(L);
@@ -163,11 +167,8 @@ static void ensure_signal_meta(lua_State* L){
 
 // exported symbol used by RunService.cpp
 void Lua_PushSignal(lua_State* L, const std::shared_ptr<RTScriptSignal>& sig) {
-    ensure_signal_meta(L);
-    void* mem = lua_newuserdata(L, sizeof(LuaSignalUD));
+    void* mem = lb::new_tagged(L, sizeof(LuaSignalUD), lb::UserdataTag::Signal);
     new (mem) LuaSignalUD{ sig };
-    luaL_getmetatable(L, "Librebox.Signal");
-    lua_setmetatable(L, -2);
 }
 // --- end Signal glue ---
 
@@ -175,15 +176,24 @@ void Lua_PushSignal(lua_State* L, const std::shared_ptr<RTScriptSignal>& sig) {
 // ================== Lua <-> Instance ==================
 void Lua_PushInstance(lua_State* L, const std::shared_ptr<Instance>& inst) {
     if (!inst) { lua_pushnil(L); return; }
-    void* userdata = lua_newuserdata(L, sizeof(std::shared_ptr<Instance>));
+    void* userdata = lb::new_tagged(L, sizeof(std::shared_ptr<Instance>), lb::UserdataTag::Instance);
     new (userdata) std::shared_ptr<Instance>(inst);
-    luaL_getmetatable(L, "Librebox.Instance");
-    lua_setmetatable(L, -2);
 }
 
-static std::shared_ptr<Instance>* l_check_instance(lua_State* L, int n) {
+std::shared_ptr<Instance>* Lua_CheckInstance(lua_State* L, int n) {
     return static_cast<std::shared_ptr<Instance>*>(
-        luaL_checkudata(L, n, "Librebox.Instance"));
+        lb::check_tagged(L, n, lb::UserdataTag::Instance, "Instance"));
+}
+
+static std::shared_ptr<Instance>* l_check_instance(lua_State* L, int n) {
+    return Lua_CheckInstance(L, n);
+}
+
+// Parallel phase: the DataModel is a read-only snapshot until task.synchronize()
+static void check_serial(lua_State* L, const char* what) {
+    if (LuaScheduler::InParallelPhase()) {
+        luaL_error(L, "%s is not allowed in parallel, call task.synchronize() first", what);
+    }
 }
 
 static int l_instance_gc(lua_State* L) {
@@ -248,7 +258,7 @@ static bool read_attribute(lua_State* L, int idx, Attribute& out) {
             out = std::string(s, len);
             return true;
         }
-        case LUA_TUSERDATA: {
+        case LUA_TVECTOR: {
             const Vector3Game* v = lb::check<Vector3Game>(L, idx);
             out = v->toRay();
             return true;
@@ -278,6 +288,7 @@ static bool read_attribute(lua_State* L, int idx, Attribute& out) {
 // ================== Instance Methods ==================
 
 static int m_SetAttribute(lua_State* L) {
+    check_serial(L, "SetAttribute");
     auto* inst_ptr = l_check_instance(L, 1);
     if (!inst_ptr || !*inst_ptr || !(*inst_ptr)->Alive) return 0;
     auto inst = *inst_ptr;
@@ -324,6 +335,7 @@ static int m_GetFullName(lua_State* L) {
 }
 
 static int m_Destroy(lua_State* L) {
+    check_serial(L, "Destroy");
     auto* inst_ptr = l_check_instance(L, 1);
     if (!inst_ptr || !*inst_ptr) return 0;
     auto inst = *inst_ptr;
@@ -340,6 +352,7 @@ static int m_Destroy(lua_State* L) {
 
 // legacy compatibility function
 static int m_LegacyFunctionRemove(lua_State* L) {
+    check_serial(L, "Remove");
     auto* inst_ptr = l_check_instance(L, 1);
     if (inst_ptr && *inst_ptr) (*inst_ptr)->LegacyFunctionRemove();
     return 0;
@@ -374,6 +387,7 @@ static int m_IsA(lua_State* L) {
 }
 
 static int m_Clone(lua_State* L) {
+    check_serial(L, "Clone");
     auto* inst_ptr = l_check_instance(L, 1);
     if (!inst_ptr || !*inst_ptr || !(*inst_ptr)->Alive) { lua_pushnil(L); return 1; }
     Lua_PushInstance(L, (*inst_ptr)->Clone());
@@ -453,6 +467,7 @@ static int m_IsAncestorOf(lua_State* L) {
 }
 
 static int m_ClearAllChildren(lua_State* L) {
+    check_serial(L, "ClearAllChildren");
     auto* self = l_check_instance(L, 1);
     if (self && *self && (*self)->Alive) (*self)->ClearAllChildren();
     return 0;
@@ -511,6 +526,7 @@ static int m_GetExtentsSize(lua_State* L) {
 }
 
 static int m_MoveTo(lua_State* L) {
+    check_serial(L, "MoveTo");
     auto* inst_ptr = l_check_instance(L, 1);
     if (!inst_ptr || !*inst_ptr || !(*inst_ptr)->Alive) return 0;
     
@@ -529,6 +545,7 @@ static int m_MoveTo(lua_State* L) {
 }
 
 static int m_TranslateBy(lua_State* L) {
+    check_serial(L, "TranslateBy");
     auto* inst_ptr = l_check_instance(L, 1);
     if (!inst_ptr || !*inst_ptr || !(*inst_ptr)->Alive) return 0;
     
@@ -547,6 +564,7 @@ static int m_TranslateBy(lua_State* L) {
 }
 
 static int m_ScaleTo(lua_State* L) {
+    check_serial(L, "ScaleTo");
     auto* inst_ptr = l_check_instance(L, 1);
     if (!inst_ptr || !*inst_ptr || !(*inst_ptr)->Alive) return 0;
     
@@ -611,6 +629,7 @@ static int m_GetPivot(lua_State* L) {
 }
 
 static int m_PivotTo(lua_State* L) {
+    check_serial(L, "PivotTo");
     auto* inst_ptr = l_check_instance(L, 1);
     if (!inst_ptr || !*inst_ptr || !(*inst_ptr)->Alive) return 0;
     
@@ -657,6 +676,21 @@ static int l_instance_index(lua_State* L) {
     // Delegate object-specific reads to the instance
     if (inst->LuaGet(L, key)) return 1;
 
+    // Tree events (ahead of children, like any other member)
+    if (key[0] == 'C' || key[0] == 'D') {
+        int ev = -1;
+        if      (std::strcmp(key, "ChildAdded") == 0)         ev = int(Instance::Event::ChildAdded);
+        else if (std::strcmp(key, "ChildRemoved") == 0)       ev = int(Instance::Event::ChildRemoved);
+        else if (std::strcmp(key, "DescendantAdded") == 0)    ev = int(Instance::Event::DescendantAdded);
+        else if (std::strcmp(key, "DescendantRemoving") == 0) ev = int(Instance::Event::DescendantRemoving);
+        if (ev >= 0) {
+            // the first read creates the signal, which writes to the instance
+            check_serial(L, "Reading an Instance event");
+            Lua_PushSignal(L, inst->GetEvent(Instance::Event(ev)));
+            return 1;
+        }
+    }
+
     // Child by name
     if (auto child = inst->FindFirstChild(key)) {
         Lua_PushInstance(L, child);
@@ -680,6 +714,7 @@ static int l_instance_index(lua_State* L) {
 }
 
 static int l_instance_newindex(lua_State* L) {
+    check_serial(L, "Setting a property");
     auto* inst_ptr = l_check_instance(L, 1);
     if (!inst_ptr || !*inst_ptr || !(*inst_ptr)->Alive) return 0;
 
@@ -728,6 +763,7 @@ static int l_instance_newindex(lua_State* L) {
 // ================== Instance API ==================
 
 static int l_Instance_new(lua_State* L) {
+    check_serial(L, "Instance.new");
     const char* typeName = luaL_checkstring(L, 1);
     LOGI("Lua Instance.new('%s')", typeName);
     Lua_PushInstance(L, Instance::New(typeName));
@@ -742,14 +778,14 @@ extern std::shared_ptr<Game> g_game;
 static int l_wait(lua_State* L) {
     double seconds = luaL_optnumber(L, 1, 0.0);
     Script* self = (Script*)lua_getthreaddata(L);
-    if (g_game && g_game->luaScheduler) {
+    if (LuaScheduler* sch = LuaScheduler::FromState(L)) {
         if (self) {
-            if (seconds > 0.0) g_game->luaScheduler->SetWaitAbs(self, GetTime() + seconds);
-            else               g_game->luaScheduler->SetWaitNextFrame(self);
+            if (seconds > 0.0) sch->SetWaitAbs(self, EngineClock::Get().Now() + seconds);
+            else               sch->SetWaitNextFrame(self);
         } else {
             // inside a task thread
-            if (seconds > 0.0) g_game->luaScheduler->SetTaskWaitAbs(L, GetTime() + seconds);
-            else               g_game->luaScheduler->SetTaskWaitNextFrame(L);
+            if (seconds > 0.0) sch->SetTaskWaitAbs(L, EngineClock::Get().Now() + seconds);
+            else               sch->SetTaskWaitNextFrame(L);
         }
     }
     return lua_yield(L, 0);
@@ -762,18 +798,18 @@ static int l_task_wait(lua_State* L) {
 // task.spawn(func, ...)
 static int l_task_spawn(lua_State* L) {
     luaL_checktype(L, 1, LUA_TFUNCTION);
-    if (!g_game || !g_game->luaScheduler) { lua_pushnil(L); return 1; }
+    LuaScheduler* sch = LuaScheduler::FromState(L);
+    if (!sch) { lua_pushnil(L); return 1; }
 
-    lua_State* LM = g_game->luaScheduler->GetMainState();
+    lua_State* LM = sch->GetMainState();
     if (!LM) { lua_pushnil(L); return 1; }
 
-    // Create new thread on main state and sandbox it
-    lua_newthread(LM);
-    lua_State* co = lua_tothread(LM, -1);
-    luaL_sandboxthread(co);
-    int ref = lua_ref(LM, -1); // pops thread from LM
-    lua_pop(LM, 1);
-    
+    // Fresh thread on the main state, charged to the spawning script
+    const int memcat = sch->MemCategoryOf(L);
+    const LuaScheduler::PooledThread t = sch->NewTaskThread(memcat);
+    lua_State* co = t.co;
+    const int ref = t.ref;
+
     // Move function + args into the new thread
     int nstack = lua_gettop(L); // includes function
     lua_xmove(L, co, nstack);
@@ -781,7 +817,7 @@ static int l_task_spawn(lua_State* L) {
     if (argc < 0) argc = 0;
 
     // Schedule next frame with pending arg count
-    g_game->luaScheduler->ScheduleTaskNextFrame(co, ref, argc);
+    sch->ScheduleTaskNextFrame(co, ref, argc, memcat);
 
     // Return the thread object
     lua_getref(LM, ref);
@@ -793,9 +829,10 @@ static int l_task_spawn(lua_State* L) {
 static int l_task_delay(lua_State* L) {
     double seconds = luaL_checknumber(L, 1);
     luaL_checktype(L, 2, LUA_TFUNCTION);
-    if (!g_game || !g_game->luaScheduler) { lua_pushnil(L); return 1; }
+    LuaScheduler* sch = LuaScheduler::FromState(L);
+    if (!sch) { lua_pushnil(L); return 1; }
 
-    lua_State* LM = g_game->luaScheduler->GetMainState();
+    lua_State* LM = sch->GetMainState();
     if (!LM) { lua_pushnil(L); return 1; }
 
     // Remove seconds so stack = func, ...
@@ -803,18 +840,17 @@ static int l_task_delay(lua_State* L) {
     int nstack = lua_gettop(L); // func + args
     int argc = nstack - 1; if (argc < 0) argc = 0;
 
-    // Create and sandbox thread
-    lua_newthread(LM);
-    lua_State* co = lua_tothread(LM, -1);
-    luaL_sandboxthread(co);
-    int ref = lua_ref(LM, -1);
-    lua_pop(LM, 1);
+    // Fresh thread on the main state
+    const int memcat = sch->MemCategoryOf(L);
+    const LuaScheduler::PooledThread t = sch->NewTaskThread(memcat);
+    lua_State* co = t.co;
+    const int ref = t.ref;
 
     // Move func+args into the new thread
     lua_xmove(L, co, nstack);
 
     // Schedule for the future
-    g_game->luaScheduler->ScheduleTaskAt(co, ref, GetTime() + std::max(0.0, seconds), argc);
+    sch->ScheduleTaskAt(co, ref, EngineClock::Get().Now() + std::max(0.0, seconds), argc, memcat);
 
     // Return the thread
     lua_getref(LM, ref);
@@ -822,43 +858,91 @@ static int l_task_delay(lua_State* L) {
     return 1;
 }
 
+// task.defer(func, ...) -> runs at the end of the current resumption cycle
+static int l_task_defer(lua_State* L) {
+    luaL_checktype(L, 1, LUA_TFUNCTION);
+    LuaScheduler* sch = LuaScheduler::FromState(L);
+    if (!sch) { lua_pushnil(L); return 1; }
+
+    lua_State* LM = sch->GetMainState();
+    if (!LM) { lua_pushnil(L); return 1; }
+
+    const int memcat = sch->MemCategoryOf(L);
+    const LuaScheduler::PooledThread t = sch->NewTaskThread(memcat);
+
+    int nstack = lua_gettop(L); // func + args
+    lua_xmove(L, t.co, nstack);
+    sch->ScheduleTaskDeferred(t.co, t.ref, nstack - 1, memcat);
+
+    lua_getref(LM, t.ref);
+    lua_xmove(LM, L, 1);
+    return 1;
+}
+
+// task.cancel(thread) -> drops a pending spawn/delay/defer, a waiting task, or a script thread
+static int l_task_cancel(lua_State* L) {
+    luaL_checktype(L, 1, LUA_TTHREAD);
+    lua_State* co = lua_tothread(L, 1);
+    LuaScheduler* sch = LuaScheduler::FromState(L);
+    if (!sch) return 0;
+
+    const int status = lua_costatus(L, co);
+    if (co == L || status == LUA_CORUN || status == LUA_CONOR) {
+        luaL_error(L, "cannot cancel a thread that is currently running");
+        return 0;
+    }
+
+    if (!sch->CancelThread(co) && status == LUA_COSUS && lua_status(co) == LUA_YIELD) {
+        // a plain coroutine the scheduler doesn't own: close it like coroutine.close
+        lua_resetthread(co);
+    }
+    return 0;
+}
+
+// task.desynchronize() -> continues in this frame's parallel phase (Actor scripts only)
+static int l_task_desynchronize(lua_State* L) {
+    LuaScheduler* sch = LuaScheduler::FromState(L);
+    if (!sch || !sch->IsActorVM()) {
+        luaL_error(L, "task.desynchronize can only be called from a script under an Actor");
+        return 0;
+    }
+    if (LuaScheduler::InParallelPhase()) return 0; // already desynchronized
+
+    if (auto* self = static_cast<BaseScript*>(lua_getthreaddata(L))) sch->SetWaitParallel(self);
+    else                                                              sch->SetTaskWaitParallel(L);
+    return lua_yield(L, 0);
+}
+
+// task.synchronize() -> continues in the next serial step, where the DataModel is writable
+static int l_task_synchronize(lua_State* L) {
+    if (!LuaScheduler::InParallelPhase()) return 0; // already serial
+    LuaScheduler* sch = LuaScheduler::FromState(L);
+    if (!sch) return 0;
+
+    if (auto* self = static_cast<BaseScript*>(lua_getthreaddata(L))) sch->SetWaitNextFrame(self);
+    else                                                              sch->SetTaskWaitNextFrame(L);
+    return lua_yield(L, 0);
+}
+
 // ================== TweenService Lua Bindings ==================
 
 // TweenInfo userdata
 struct LuaTweenInfoUD { TweenInfo info; };
 
 static LuaTweenInfoUD* checkTweenInfo(lua_State* L, int idx) {
-    return static_cast<LuaTweenInfoUD*>(luaL_checkudata(L, idx, "Librebox.TweenInfo"));
+    return static_cast<LuaTweenInfoUD*>(lb::check_tagged(L, idx, lb::UserdataTag::TweenInfo, "TweenInfo"));
 }
 
 static int l_TweenInfo_new(lua_State* L) {
     float time = (float)luaL_optnumber(L, 1, 1.0);
     
-    // Handle easing style parameter (can be integer or enum item table)
+    // Handle easing style parameter (can be integer or enum item)
     int easingStyleInt = (int)EasingStyle::Quad; // default
-    if (lua_type(L, 2) == LUA_TNUMBER) {
-        easingStyleInt = (int)lua_tointeger(L, 2);
-    } else if (lua_type(L, 2) == LUA_TTABLE) {
-        // Extract Value from enum item table
-        lua_getfield(L, 2, "Value");
-        if (lua_isnumber(L, -1)) {
-            easingStyleInt = (int)lua_tointeger(L, -1);
-        }
-        lua_pop(L, 1);
-    }
+    Lua_ToEnumValue(L, 2, easingStyleInt);
     
-    // Handle easing direction parameter (can be integer or enum item table)
+    // Handle easing direction parameter (can be integer or enum item)
     int easingDirectionInt = (int)EasingDirection::Out; // default
-    if (lua_type(L, 3) == LUA_TNUMBER) {
-        easingDirectionInt = (int)lua_tointeger(L, 3);
-    } else if (lua_type(L, 3) == LUA_TTABLE) {
-        // Extract Value from enum item table
-        lua_getfield(L, 3, "Value");
-        if (lua_isnumber(L, -1)) {
-            easingDirectionInt = (int)lua_tointeger(L, -1);
-        }
-        lua_pop(L, 1);
-    }
+    Lua_ToEnumValue(L, 3, easingDirectionInt);
     
     int repeatCount = (int)luaL_optinteger(L, 4, 0);
     bool reverses = lua_toboolean(L, 5);
@@ -867,10 +951,8 @@ static int l_TweenInfo_new(lua_State* L) {
     EasingStyle easingStyle = static_cast<EasingStyle>(easingStyleInt);
     EasingDirection easingDirection = static_cast<EasingDirection>(easingDirectionInt);
 
-    void* mem = lua_newuserdata(L, sizeof(LuaTweenInfoUD));
+    void* mem = lb::new_tagged(L, sizeof(LuaTweenInfoUD), lb::UserdataTag::TweenInfo);
     new (mem) LuaTweenInfoUD{ TweenInfo(time, easingStyle, easingDirection, repeatCount, reverses, delayTime) };
-    luaL_getmetatable(L, "Librebox.TweenInfo");
-    lua_setmetatable(L, -2);
     return 1;
 }
 
@@ -884,6 +966,9 @@ static void ensure_tweeninfo_meta(lua_State* L) {
     if (luaL_newmetatable(L, "Librebox.TweenInfo")) {
         lua_pushcfunction(L, l_TweenInfo_gc, "__gc");
         lua_setfield(L, -2, "__gc");
+        lua_pushstring(L, "TweenInfo");
+        lua_setfield(L, -2, "__type");
+        lb::set_tag_metatable(L, lb::UserdataTag::TweenInfo);
     }
     lua_pop(L, 1);
 }
@@ -892,28 +977,32 @@ static void ensure_tweeninfo_meta(lua_State* L) {
 struct LuaTweenUD { std::shared_ptr<Tween> tween; };
 
 static LuaTweenUD* checkTween(lua_State* L, int idx) {
-    return static_cast<LuaTweenUD*>(luaL_checkudata(L, idx, "Librebox.Tween"));
+    return static_cast<LuaTweenUD*>(lb::check_tagged(L, idx, lb::UserdataTag::Tween, "Tween"));
 }
 
 static int l_Tween_Play(lua_State* L) {
+    check_serial(L, "Tween:Play");
     auto* t = checkTween(L, 1);
     if (t && t->tween) t->tween->Play();
     return 0;
 }
 
 static int l_Tween_Pause(lua_State* L) {
+    check_serial(L, "Tween:Pause");
     auto* t = checkTween(L, 1);
     if (t && t->tween) t->tween->Pause();
     return 0;
 }
 
 static int l_Tween_Cancel(lua_State* L) {
+    check_serial(L, "Tween:Cancel");
     auto* t = checkTween(L, 1);
     if (t && t->tween) t->tween->Cancel();
     return 0;
 }
 
 static int l_Tween_Destroy(lua_State* L) {
+    check_serial(L, "Tween:Destroy");
     auto* t = checkTween(L, 1);
     if (t && t->tween) t->tween->Destroy();
     return 0;
@@ -968,16 +1057,16 @@ static void ensure_tween_meta(lua_State* L) {
         lua_setfield(L, -2, "__index");
         lua_pushcfunction(L, l_Tween_gc, "__gc");
         lua_setfield(L, -2, "__gc");
+        lua_pushstring(L, "Tween");
+        lua_setfield(L, -2, "__type");
+        lb::set_tag_metatable(L, lb::UserdataTag::Tween);
     }
     lua_pop(L, 1);
 }
 
 void Lua_PushTween(lua_State* L, const std::shared_ptr<Tween>& tween) {
-    ensure_tween_meta(L);
-    void* mem = lua_newuserdata(L, sizeof(LuaTweenUD));
+    void* mem = lb::new_tagged(L, sizeof(LuaTweenUD), lb::UserdataTag::Tween);
     new (mem) LuaTweenUD{ tween };
-    luaL_getmetatable(L, "Librebox.Tween");
-    lua_setmetatable(L, -2);
 }
 
 // ================== Global API Registration ==================
@@ -1033,9 +1122,15 @@ void RegisterSharedLibreboxAPI(lua_State* L) {
     lua_pushcfunction(L, l_instance_gc,      "gc");       lua_setfield(L, -2, "__gc");
     lua_pushcfunction(L, l_instance_eq,      "eq");       lua_setfield(L, -2, "__eq");
     lua_pushcfunction(L, l_instance_tostring, "tostring");lua_setfield(L, -2, "__tostring");
+    lua_pushstring(L, "Instance");                        lua_setfield(L, -2, "__type");
+    lb::set_tag_metatable(L, lb::UserdataTag::Instance);
 
     lua_pop(L, 1);
 
+    // Signal, Connection and Tween metatables (tagged userdata need them up front)
+    ensure_signal_meta(L);
+    ensure_tween_meta(L);
+
     // Instance library
     lua_newtable(L);
     lua_pushcfunction(L, l_Instance_new, "new");
@@ -1044,7 +1139,7 @@ void RegisterSharedLibreboxAPI(lua_State* L) {
 
     // Engine datatypes
     lb::register_type<Vector2Game>(L);
-    lb::register_type<Vector3Game>(L);
+    lb::register_vector3(L);
     lb::register_type<CFrame>(L);
     lb::register_type<Color3>(L);
     lb::register_type<Random>(L);
@@ -1058,6 +1153,10 @@ void RegisterSharedLibreboxAPI(lua_State* L) {
     lua_pushcfunction(L, l_task_wait,  "wait");  lua_setfield(L, -2, "wait");
     lua_pushcfunction(L, l_task_spawn, "spawn"); lua_setfield(L, -2, "spawn");
     lua_pushcfunction(L, l_task_delay, "delay"); lua_setfield(L, -2, "delay");
+    lua_pushcfunction(L, l_task_defer, "defer"); lua_setfield(L, -2, "defer");
+    lua_pushcfunction(L, l_task_cancel, "cancel"); lua_setfield(L, -2, "cancel");
+    lua_pushcfunction(L, l_task_desynchronize, "desynchronize"); lua_setfield(L, -2, "desynchronize");
+    lua_pushcfunction(L, l_task_synchronize,   "synchronize");   lua_setfield(L, -2, "synchronize");
     lua_setglobal(L, "task");
 
     // TweenInfo library
@@ -1067,159 +1166,9 @@ void RegisterSharedLibreboxAPI(lua_State* L) {
     lua_setfield(L, -2, "new");
     lua_setglobal(L, "TweenInfo");
 
-    // Enum global table
-    RegisterEnumGlobal(L);
-}
+    // require(), with a module cache for this VM
+    ModuleLoader::Open(L);
 
-// Register the Enum global table
-static void RegisterEnumGlobal(lua_State* L) {
-    lua_newtable(L); // Main Enum table
-    
-    // Get all enums from registry and add them
-    EnumRegistry& registry = EnumRegistry::Instance();
-    
-    // UserInputType enum
-    if (Enum* userInputType = registry.GetEnum("UserInputType")) {
-        lua_newtable(L); // UserInputType table
-        
-        // Pre-populate all enum items as actual table entries (not metatable)
-        // This ensures the same table instance is returned every time
-        lua_pushstring(L, "None"); Lua_PushEnumItem(L, userInputType->GetItem("None")); lua_settable(L, -3);
-        lua_pushstring(L, "MouseButton1"); Lua_PushEnumItem(L, userInputType->GetItem("MouseButton1")); lua_settable(L, -3);
-        lua_pushstring(L, "MouseButton2"); Lua_PushEnumItem(L, userInputType->GetItem("MouseButton2")); lua_settable(L, -3);
-        lua_pushstring(L, "MouseButton3"); Lua_PushEnumItem(L, userInputType->GetItem("MouseButton3")); lua_settable(L, -3);
-        lua_pushstring(L, "MouseWheel"); Lua_PushEnumItem(L, userInputType->GetItem("MouseWheel")); lua_settable(L, -3);
-        lua_pushstring(L, "MouseMovement"); Lua_PushEnumItem(L, userInputType->GetItem("MouseMovement")); lua_settable(L, -3);
-        lua_pushstring(L, "Touch"); Lua_PushEnumItem(L, userInputType->GetItem("Touch")); lua_settable(L, -3);
-        lua_pushstring(L, "Keyboard"); Lua_PushEnumItem(L, userInputType->GetItem("Keyboard")); lua_settable(L, -3);
-        lua_pushstring(L, "Focus"); Lua_PushEnumItem(L, userInputType->GetItem("Focus")); lua_settable(L, -3);
-        lua_pushstring(L, "Accelerometer"); Lua_PushEnumItem(L, userInputType->GetItem("Accelerometer")); lua_settable(L, -3);
-        lua_pushstring(L, "Gyroscope"); Lua_PushEnumItem(L, userInputType->GetItem("Gyroscope")); lua_settable(L, -3);
-        lua_pushstring(L, "Gamepad1"); Lua_PushEnumItem(L, userInputType->GetItem("Gamepad1")); lua_settable(L, -3);
-        lua_pushstring(L, "Gamepad2"); Lua_PushEnumItem(L, userInputType->GetItem("Gamepad2")); lua_settable(L, -3);
-        lua_pushstring(L, "Gamepad3"); Lua_PushEnumItem(L, userInputType->GetItem("Gamepad3")); lua_settable(L, -3);
-        lua_pushstring(L, "Gamepad4"); Lua_PushEnumItem(L, userInputType->GetItem("Gamepad4")); lua_settable(L, -3);
-        lua_pushstring(L, "TextInput"); Lua_PushEnumItem(L, userInputType->GetItem("TextInput")); lua_settable(L, -3);
-        
-        lua_setfield(L, -2, "UserInputType");
-    }
-    
-    // KeyCode enum
-    if (Enum* keyCode = registry.GetEnum("KeyCode")) {
-        lua_newtable(L); // KeyCode table
-        
-        // Pre-populate all KeyCode enum items
-        lua_pushstring(L, "Unknown"); Lua_PushEnumItem(L, keyCode->GetItem("Unknown")); lua_settable(L, -3);
-        lua_pushstring(L, "A"); Lua_PushEnumItem(L, keyCode->GetItem("A")); lua_settable(L, -3);
-        lua_pushstring(L, "B"); Lua_PushEnumItem(L, keyCode->GetItem("B")); lua_settable(L, -3);
-        lua_pushstring(L, "C"); Lua_PushEnumItem(L, keyCode->GetItem("C")); lua_settable(L, -3);
-        lua_pushstring(L, "D"); Lua_PushEnumItem(L, keyCode->GetItem("D")); lua_settable(L, -3);
-        lua_pushstring(L, "E"); Lua_PushEnumItem(L, keyCode->GetItem("E")); lua_settable(L, -3);
-        lua_pushstring(L, "F"); Lua_PushEnumItem(L, keyCode->GetItem("F")); lua_settable(L, -3);
-        lua_pushstring(L, "G"); Lua_PushEnumItem(L, keyCode->GetItem("G")); lua_settable(L, -3);
-        lua_pushstring(L, "H"); Lua_PushEnumItem(L, keyCode->GetItem("H")); lua_settable(L, -3);
-        lua_pushstring(L, "I"); Lua_PushEnumItem(L, keyCode->GetItem("I")); lua_settable(L, -3);
-        lua_pushstring(L, "J"); Lua_PushEnumItem(L, keyCode->GetItem("J")); lua_settable(L, -3);
-        lua_pushstring(L, "K"); Lua_PushEnumItem(L, keyCode->GetItem("K")); lua_settable(L, -3);
-        lua_pushstring(L, "L"); Lua_PushEnumItem(L, keyCode->GetItem("L")); lua_settable(L, -3);
-        lua_pushstring(L, "M"); Lua_PushEnumItem(L, keyCode->GetItem("M")); lua_settable(L, -3);
-        lua_pushstring(L, "N"); Lua_PushEnumItem(L, keyCode->GetItem("N")); lua_settable(L, -3);
-        lua_pushstring(L, "O"); Lua_PushEnumItem(L, keyCode->GetItem("O")); lua_settable(L, -3);
-        lua_pushstring(L, "P"); Lua_PushEnumItem(L, keyCode->GetItem("P")); lua_settable(L, -3);
-        lua_pushstring(L, "Q"); Lua_PushEnumItem(L, keyCode->GetItem("Q")); lua_settable(L, -3);
-        lua_pushstring(L, "R"); Lua_PushEnumItem(L, keyCode->GetItem("R")); lua_settable(L, -3);
-        lua_pushstring(L, "S"); Lua_PushEnumItem(L, keyCode->GetItem("S")); lua_settable(L, -3);
-        lua_pushstring(L, "T"); Lua_PushEnumItem(L, keyCode->GetItem("T")); lua_settable(L, -3);
-        lua_pushstring(L, "U"); Lua_PushEnumItem(L, keyCode->GetItem("U")); lua_settable(L, -3);
-        lua_pushstring(L, "V"); Lua_PushEnumItem(L, keyCode->GetItem("V")); lua_settable(L, -3);
-        lua_pushstring(L, "W"); Lua_PushEnumItem(L, keyCode->GetItem("W")); lua_settable(L, -3);
-        lua_pushstring(L, "X"); Lua_PushEnumItem(L, keyCode->GetItem("X")); lua_settable(L, -3);
-        lua_pushstring(L, "Y"); Lua_PushEnumItem(L, keyCode->GetItem("Y")); lua_settable(L, -3);
-        lua_pushstring(L, "Z"); Lua_PushEnumItem(L, keyCode->GetItem("Z")); lua_settable(L, -3);
-        lua_pushstring(L, "Zero"); Lua_PushEnumItem(L, keyCode->GetItem("Zero")); lua_settable(L, -3);
-        lua_pushstring(L, "One"); Lua_PushEnumItem(L, keyCode->GetItem("One")); lua_settable(L, -3);
-        lua_pushstring(L, "Two"); Lua_PushEnumItem(L, keyCode->GetItem("Two")); lua_settable(L, -3);
-        lua_pushstring(L, "Three"); Lua_PushEnumItem(L, keyCode->GetItem("Three")); lua_settable(L, -3);
-        lua_pushstring(L, "Four"); Lua_PushEnumItem(L, keyCode->GetItem("Four")); lua_settable(L, -3);
-        lua_pushstring(L, "Five"); Lua_PushEnumItem(L, keyCode->GetItem("Five")); lua_settable(L, -3);
-        lua_pushstring(L, "Six"); Lua_PushEnumItem(L, keyCode->GetItem("Six")); lua_settable(L, -3);
-        lua_pushstring(L, "Seven"); Lua_PushEnumItem(L, keyCode->GetItem("Seven")); lua_settable(L, -3);
-        lua_pushstring(L, "Eight"); Lua_PushEnumItem(L, keyCode->GetItem("Eight")); lua_settable(L, -3);
-        lua_pushstring(L, "Nine"); Lua_PushEnumItem(L, keyCode->GetItem("Nine")); lua_settable(L, -3);
-        lua_pushstring(L, "Space"); Lua_PushEnumItem(L, keyCode->GetItem("Space")); lua_settable(L, -3);
-        lua_pushstring(L, "Return"); Lua_PushEnumItem(L, keyCode->GetItem("Return")); lua_settable(L, -3);
-        lua_pushstring(L, "Escape"); Lua_PushEnumItem(L, keyCode->GetItem("Escape")); lua_settable(L, -3);
-        lua_pushstring(L, "Backspace"); Lua_PushEnumItem(L, keyCode->GetItem("Backspace")); lua_settable(L, -3);
-        lua_pushstring(L, "Right"); Lua_PushEnumItem(L, keyCode->GetItem("Right")); lua_settable(L, -3);
-        lua_pushstring(L, "Left"); Lua_PushEnumItem(L, keyCode->GetItem("Left")); lua_settable(L, -3);
-        lua_pushstring(L, "Down"); Lua_PushEnumItem(L, keyCode->GetItem("Down")); lua_settable(L, -3);
-        lua_pushstring(L, "Up"); Lua_PushEnumItem(L, keyCode->GetItem("Up")); lua_settable(L, -3);
-        lua_pushstring(L, "LeftShift"); Lua_PushEnumItem(L, keyCode->GetItem("LeftShift")); lua_settable(L, -3);
-        lua_pushstring(L, "RightShift"); Lua_PushEnumItem(L, keyCode->GetItem("RightShift")); lua_settable(L, -3);
-        lua_pushstring(L, "LeftControl"); Lua_PushEnumItem(L, keyCode->GetItem("LeftControl")); lua_settable(L, -3);
-        lua_pushstring(L, "RightControl"); Lua_PushEnumItem(L, keyCode->GetItem("RightControl")); lua_settable(L, -3);
-        lua_pushstring(L, "LeftAlt"); Lua_PushEnumItem(L, keyCode->GetItem("LeftAlt")); lua_settable(L, -3);
-        lua_pushstring(L, "RightAlt"); Lua_PushEnumItem(L, keyCode->GetItem("RightAlt")); lua_settable(L, -3);
-        lua_pushstring(L, "MouseButton1"); Lua_PushEnumItem(L, keyCode->GetItem("MouseButton1")); lua_settable(L, -3);
-        lua_pushstring(L, "MouseButton2"); Lua_PushEnumItem(L, keyCode->GetItem("MouseButton2")); lua_settable(L, -3);
-        lua_pushstring(L, "MouseButton3"); Lua_PushEnumItem(L, keyCode->GetItem("MouseButton3")); lua_settable(L, -3);
-        
-        lua_setfield(L, -2, "KeyCode");
-    }
-    
-    // EasingStyle enum
-    if (Enum* easingStyle = registry.GetEnum("EasingStyle")) {
-        lua_newtable(L); // EasingStyle table
-        
-        lua_pushstring(L, "Linear"); Lua_PushEnumItem(L, easingStyle->GetItem("Linear")); lua_settable(L, -3);
-        lua_pushstring(L, "Sine"); Lua_PushEnumItem(L, easingStyle->GetItem("Sine")); lua_settable(L, -3);
-        lua_pushstring(L, "Back"); Lua_PushEnumItem(L, easingStyle->GetItem("Back")); lua_settable(L, -3);
-        lua_pushstring(L, "Quad"); Lua_PushEnumItem(L, easingStyle->GetItem("Quad")); lua_settable(L, -3);
-        lua_pushstring(L, "Quart"); Lua_PushEnumItem(L, easingStyle->GetItem("Quart")); lua_settable(L, -3);
-        lua_pushstring(L, "Quint"); Lua_PushEnumItem(L, easingStyle->GetItem("Quint")); lua_settable(L, -3);
-        lua_pushstring(L, "Bounce"); Lua_PushEnumItem(L, easingStyle->GetItem("Bounce")); lua_settable(L, -3);
-        lua_pushstring(L, "Elastic"); Lua_PushEnumItem(L, easingStyle->GetItem("Elastic")); lua_settable(L, -3);
-        lua_pushstring(L, "Exponential"); Lua_PushEnumItem(L, easingStyle->GetItem("Exponential")); lua_settable(L, -3);
-        lua_pushstring(L, "Circular"); Lua_PushEnumItem(L, easingStyle->GetItem("Circular")); lua_settable(L, -3);
-        lua_pushstring(L, "Cubic"); Lua_PushEnumItem(L, easingStyle->GetItem("Cubic")); lua_settable(L, -3);
-        
-        lua_setfield(L, -2, "EasingStyle");
-    }
-    
-    // EasingDirection enum
-    if (Enum* easingDirection = registry.GetEnum("EasingDirection")) {
-        lua_newtable(L); // EasingDirection table
-        
-        lua_pushstring(L, "In"); Lua_PushEnumItem(L, easingDirection->GetItem("In")); lua_settable(L, -3);
-        lua_pushstring(L, "Out"); Lua_PushEnumItem(L, easingDirection->GetItem("Out")); lua_settable(L, -3);
-        lua_pushstring(L, "InOut"); Lua_PushEnumItem(L, easingDirection->GetItem("InOut")); lua_settable(L, -3);
-        
-        lua_setfield(L, -2, "EasingDirection");
-    }
-    
-    // MouseBehavior enum
-    if (Enum* mouseBehavior = registry.GetEnum("MouseBehavior")) {
-        lua_newtable(L); // MouseBehavior table
-        
-        lua_pushstring(L, "Default"); Lua_PushEnumItem(L, mouseBehavior->GetItem("Default")); lua_settable(L, -3);
-        lua_pushstring(L, "LockCenter"); Lua_PushEnumItem(L, mouseBehavior->GetItem("LockCenter")); lua_settable(L, -3);
-        lua_pushstring(L, "LockCurrentPosition"); Lua_PushEnumItem(L, mouseBehavior->GetItem("LockCurrentPosition")); lua_settable(L, -3);
-        
-        lua_setfield(L, -2, "MouseBehavior");
-    }
-    
-    // PartType enum
-    if (Enum* partType = registry.GetEnum("PartType")) {
-        lua_newtable(L); // PartType table
-        
-        lua_pushstring(L, "Ball"); Lua_PushEnumItem(L, partType->GetItem("Ball")); lua_settable(L, -3);
-        lua_pushstring(L, "Block"); Lua_PushEnumItem(L, partType->GetItem("Block")); lua_settable(L, -3);
-        lua_pushstring(L, "Cylinder"); Lua_PushEnumItem(L, partType->GetItem("Cylinder")); lua_settable(L, -3);
-        lua_pushstring(L, "Wedge"); Lua_PushEnumItem(L, partType->GetItem("Wedge")); lua_settable(L, -3);
-        lua_pushstring(L, "CornerWedge"); Lua_PushEnumItem(L, partType->GetItem("CornerWedge")); lua_settable(L, -3);
-        
-        lua_setfield(L, -2, "PartType");
-    }
-    
-    lua_setglobal(L, "Enum");
+    // Enum global table
+    Lua_RegisterEnums(L);
 }
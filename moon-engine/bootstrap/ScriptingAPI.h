@@ -9,4 +9,6 @@ void RegisterSharedLibreboxAPI(lua_State* L);
 
 // Utility used by scripts to pass Instances to Luau
 void Lua_PushInstance(lua_State* L, const std::shared_ptr<Instance>& inst);
+// Instance userdata at idx, or a Lua type error
+std::shared_ptr<Instance>* Lua_CheckInstance(lua_State* L, int idx);
 void Lua_PushSignal(lua_State* L, const std::shared_ptr<RTScriptSignal>& sig);
\ No newline at end of file
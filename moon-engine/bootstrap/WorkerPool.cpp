@@ -0,0 +1,92 @@
+// ================== bootstrap/WorkerPool.cpp ==================
+#include "bootstrap/WorkerPool.h"
+#include "core/logging/Logging.h"
+
+#include <algorithm>
+
+WorkerPool& WorkerPool::Get() {
+    // one core stays with the main thread, which also pulls work in ParallelFor
+    static WorkerPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+WorkerPool::WorkerPool(size_t workers) {
+    threads.reserve(workers);
+    for (size_t i = 0; i < workers; ++i) {
+        threads.emplace_back([this]{ WorkerMain(); });
+    }
+    LOGI("WorkerPool: %zu worker thread(s)", workers);
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lk(mtx);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& t : threads) {
+        if (t.joinable()) t.join();
+    }
+}
+
+void WorkerPool::RunJobs(const std::function<void(size_t)>& fn, size_t count) {
+    for (;;) {
+        const size_t i = nextIndex.fetch_add(1, std::memory_order_relaxed);
+        if (i >= count) break;
+        fn(i);
+    }
+}
+
+void WorkerPool::WorkerMain() {
+    uint64_t seen = 0;
+    for (;;) {
+        // the batch is read under the lock: ParallelFor rewrites it for the next generation
+        const std::function<void(size_t)>* fn = nullptr;
+        size_t count = 0;
+        {
+            std::unique_lock<std::mutex> lk(mtx);
+            wake.wait(lk, [&]{ return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            if (!job) continue; // woke after that batch was already finished
+            fn    = job;
+            count = jobCount;
+            busy++;
+        }
+
+        RunJobs(*fn, count);
+
+        {
+            std::lock_guard<std::mutex> lk(mtx);
+            busy--;
+        }
+        done.notify_one();
+    }
+}
+
+void WorkerPool::ParallelFor(size_t count, const std::function<void(size_t)>& fn) {
+    if (count == 0) return;
+
+    // nothing to fan out
+    if (count == 1 || threads.empty()) {
+        for (size_t i = 0; i < count; ++i) fn(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(mtx);
+        job      = &fn;
+        jobCount = count;
+        nextIndex.store(0, std::memory_order_relaxed);
+        generation++;
+    }
+    wake.notify_all();
+
+    RunJobs(fn, count);
+
+    // wait for workers that picked up this batch to leave it
+    std::unique_lock<std::mutex> lk(mtx);
+    done.wait(lk, [&]{ return busy == 0; });
+    job      = nullptr;
+    jobCount = 0;
+}
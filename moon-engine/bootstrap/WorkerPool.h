@@ -0,0 +1,46 @@
+// ================== bootstrap/WorkerPool.h ==================
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Small fork/join pool used for the parallel (desynchronized) script phase.
+// The calling thread takes part in the work, so a pool of N workers uses N+1 cores.
+class WorkerPool {
+public:
+    static WorkerPool& Get();
+
+    explicit WorkerPool(size_t workers);
+    ~WorkerPool();
+
+    // Runs fn(0..count-1) across the pool and blocks until every index is done.
+    void ParallelFor(size_t count, const std::function<void(size_t)>& fn);
+
+    size_t WorkerCount() const { return threads.size(); }
+
+    WorkerPool(const WorkerPool&)            = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+private:
+    void WorkerMain();
+    void RunJobs(const std::function<void(size_t)>& fn, size_t count);
+
+    std::vector<std::thread> threads;
+    std::mutex               mtx;
+    std::condition_variable  wake;
+    std::condition_variable  done;
+
+    // current batch
+    const std::function<void(size_t)>* job = nullptr;
+    size_t              jobCount   = 0;
+    std::atomic<size_t> nextIndex{0};
+    size_t              busy       = 0;   // workers still inside the batch
+    uint64_t            generation = 0;
+    bool                stopping   = false;
+};
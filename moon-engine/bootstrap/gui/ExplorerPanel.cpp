@@ -11,6 +11,20 @@ ExplorerPanel::ExplorerPanel(GuiManager* manager) : guiManager(manager) {
 }
 
 ExplorerPanel::~ExplorerPanel() {
+    WatchRoot(false);
+}
+
+void ExplorerPanel::WatchRoot(bool watch) {
+    if (!rootInstance) return;
+    if (!watch) {
+        rootInstance->Disconnect(descAddedConn);
+        rootInstance->Disconnect(descRemovingConn);
+        descAddedConn = descRemovingConn = 0;
+        return;
+    }
+    auto markDirty = [this](const std::shared_ptr<Instance>&) { treeDirty = true; };
+    descAddedConn    = rootInstance->OnDescendantAdded(markDirty);
+    descRemovingConn = rootInstance->OnDescendantRemoved(markDirty);
 }
 
 void ExplorerPanel::Render(Rectangle bounds) {
@@ -240,12 +254,9 @@ void ExplorerPanel::Update() {
         scrollY = Clamp(scrollY, 0.0f, fmaxf(0.0f, contentHeight - 400.0f));
     }
     
-    // Auto-refresh tree periodically to catch changes
-    static double lastRefreshTime = 0.0;
-    double currentTime = GetTime();
-    if (currentTime - lastRefreshTime > 1.0) { // Refresh every second
+    // Rebuild once per frame at most, however many instances moved
+    if (treeDirty) {
         RefreshTree();
-        lastRefreshTime = currentTime;
     }
     
     // Update visible nodes list and selected node index
@@ -254,6 +265,7 @@ void ExplorerPanel::Update() {
 }
 
 void ExplorerPanel::RefreshTree() {
+    treeDirty = false;
     if (!rootInstance) return;
     
     // Store current expansion states before rebuilding
@@ -276,7 +288,11 @@ void ExplorerPanel::RefreshTree() {
 }
 
 void ExplorerPanel::SetRootInstance(std::shared_ptr<Instance> root) {
-    rootInstance = root;
+    if (root != rootInstance) {
+        WatchRoot(false);
+        rootInstance = root;
+        WatchRoot(true);
+    }
     RefreshTree();
 }
 
@@ -484,6 +500,7 @@ Color ExplorerPanel::GetNodeColor(std::shared_ptr<Instance> instance) {
             return {255, 200, 100, 255}; // Orange
         case InstanceClass::Script:
         case InstanceClass::LocalScript:
+        case InstanceClass::ModuleScript:
             return {255, 150, 150, 255}; // Red
         case InstanceClass::Folder:
             return {200, 200, 100, 255}; // Yellow
@@ -510,6 +527,8 @@ const char* ExplorerPanel::GetNodeIcon(std::shared_ptr<Instance> instance) {
             return "S";
         case InstanceClass::LocalScript:
             return "L";
+        case InstanceClass::ModuleScript:
+            return "D";
         case InstanceClass::Folder:
             return "F";
         case InstanceClass::Camera:
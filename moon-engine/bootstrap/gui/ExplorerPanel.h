@@ -24,6 +24,12 @@ public:
 private:
     GuiManager* guiManager;
     std::shared_ptr<Instance> rootInstance;
+
+    // The tree is rebuilt when the root's DescendantAdded/DescendantRemoving fire, not polled
+    void WatchRoot(bool watch);
+    size_t descAddedConn = 0;
+    size_t descRemovingConn = 0;
+    bool treeDirty = false;
     
     // Tree state
     struct TreeNode {
@@ -5,6 +5,8 @@
 #include "bootstrap/instances/Folder.h"
 #include "bootstrap/instances/CameraGame.h"
 #include "bootstrap/instances/Workspace.h"
+#include "bootstrap/instances/BaseScript.h"
+#include "bootstrap/LuaScheduler.h"
 #include <raylib.h>
 #include <raymath.h>
 #include <sstream>
@@ -155,6 +157,11 @@ void PropertyPanel::Render(Rectangle bounds) {
 
 void PropertyPanel::Update() {
     UpdateTextInput();
+
+    // Refresh live read-only values
+    for (auto& prop : properties) {
+        if (prop.getter) prop.getter();
+    }
     
     // Handle scrolling
     float wheelMove = GetMouseWheelMove();
@@ -529,6 +536,24 @@ void PropertyPanel::AddBasicInstanceProperties(std::shared_ptr<Instance> instanc
 }
 
 void PropertyPanel::AddSpecificProperties(std::shared_ptr<Instance> instance) {
+    // Scripts: live Lua heap readout
+    if (auto script = std::dynamic_pointer_cast<BaseScript>(instance)) {
+        Property memProp;
+        memProp.name = "MemoryUsage";
+        memProp.displayName = "Lua Memory";
+        memProp.type = PropertyType::String;
+        memProp.readOnly = true;
+        const size_t idx = properties.size();
+        memProp.getter = [script, idx, this]() {
+            auto* sched = script->RunningScheduler();
+            const size_t bytes = sched ? sched->GetScriptMemory(script.get()) : 0;
+            properties[idx].value = std::string(TextFormat("%.1f KB", bytes / 1024.0));
+        };
+        properties.push_back(memProp);
+        properties[idx].getter();
+        return;
+    }
+
     // Add properties specific to Workspace instances
     if (auto workspace = std::dynamic_pointer_cast<Workspace>(instance)) {
         // CurrentCamera property (read-only reference)
@@ -736,6 +761,7 @@ void PropertyPanel::AddSpecificProperties(std::shared_ptr<Instance> instance) {
                 if (prop.name == "Position") {
                     if (auto* vec3Val = std::get_if<::Vector3>(&prop.value)) {
                         basePart->CF.p = Vector3Game::fromRay(*vec3Val);
+                        basePart->MarkRenderDirty();
                     }
                     break;
                 }
@@ -768,6 +794,7 @@ void PropertyPanel::AddSpecificProperties(std::shared_ptr<Instance> instance) {
                         CFrame newCF = CFrame::fromOrientation(rx, ry, rz);
                         newCF.p = basePart->CF.p; // Keep the same position
                         basePart->CF = newCF;
+                        basePart->MarkRenderDirty();
                     }
                     break;
                 }
@@ -787,6 +814,7 @@ void PropertyPanel::AddSpecificProperties(std::shared_ptr<Instance> instance) {
                 if (prop.name == "Size") {
                     if (auto* vec3Val = std::get_if<::Vector3>(&prop.value)) {
                         basePart->Size = *vec3Val;
+                        basePart->MarkRenderDirty();
                     }
                     break;
                 }
@@ -815,6 +843,7 @@ void PropertyPanel::AddSpecificProperties(std::shared_ptr<Instance> instance) {
                         basePart->Color.r = colorVal->r / 255.0f;
                         basePart->Color.g = colorVal->g / 255.0f;
                         basePart->Color.b = colorVal->b / 255.0f;
+                        basePart->MarkRenderDirty();
                     }
                     break;
                 }
@@ -833,6 +862,7 @@ void PropertyPanel::AddSpecificProperties(std::shared_ptr<Instance> instance) {
                 if (prop.name == "Transparency") {
                     if (auto* floatVal = std::get_if<float>(&prop.value)) {
                         basePart->Transparency = Clamp(*floatVal, 0.0f, 1.0f);
+                        basePart->MarkRenderDirty();
                     }
                     break;
                 }
@@ -875,6 +905,25 @@ void PropertyPanel::AddSpecificProperties(std::shared_ptr<Instance> instance) {
             }
         };
         properties.push_back(canCollideProp);
+        
+        // CastShadow property
+        Property castShadowProp;
+        castShadowProp.name = "CastShadow";
+        castShadowProp.displayName = "CastShadow";
+        castShadowProp.type = PropertyType::Boolean;
+        castShadowProp.value = basePart->CastShadow;
+        castShadowProp.setter = [basePart, this]() {
+            for (auto& prop : properties) {
+                if (prop.name == "CastShadow") {
+                    if (auto* boolVal = std::get_if<bool>(&prop.value)) {
+                        basePart->CastShadow = *boolVal;
+                        basePart->MarkRenderDirty();
+                    }
+                    break;
+                }
+            }
+        };
+        properties.push_back(castShadowProp);
     }
 }
 
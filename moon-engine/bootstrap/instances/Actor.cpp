@@ -0,0 +1,116 @@
+// instances/Actor.cpp
+#include "bootstrap/instances/Actor.h"
+#include "bootstrap/EngineClock.h"
+#include "bootstrap/Game.h"
+#include "bootstrap/ScriptingAPI.h"
+#include "bootstrap/WorkerPool.h"
+#include "core/logging/Logging.h"
+#include <utility>
+#include <vector>
+
+extern std::shared_ptr<Game> g_game;
+
+static Instance::Registrar _reg_actor("Actor", [] {
+    return std::make_shared<Actor>("Actor");
+});
+
+// Actors with a live VM, in creation order
+static std::vector<std::weak_ptr<Actor>>& LiveActors() {
+    static std::vector<std::weak_ptr<Actor>> v;
+    return v;
+}
+
+// VMs of destroyed actors; a script may destroy its own actor mid-resume,
+// so the VM is only closed at the start of the next StepAll.
+static std::vector<std::unique_ptr<LuaScheduler>>& RetiredSchedulers() {
+    static std::vector<std::unique_ptr<LuaScheduler>> v;
+    return v;
+}
+
+Actor::Actor(std::string name)
+    : Instance(std::move(name), InstanceClass::Actor) {
+    LOGI("Actor created '%s'", Name.c_str());
+}
+
+Actor::~Actor() = default;
+
+LuaScheduler* Actor::GetScheduler() {
+    if (scheduler || !Alive) return scheduler.get();
+
+    auto sch = std::make_unique<LuaScheduler>();
+    lua_State* L = sch->GetMainState();
+    if (!L) {
+        LOGE("Actor '%s': failed to create VM", Name.c_str());
+        return nullptr;
+    }
+    sch->SetActorVM(true);
+    if (g_game && g_game->luaScheduler) {
+        sch->defaultLimits = g_game->luaScheduler->defaultLimits;
+    }
+
+    RegisterSharedLibreboxAPI(L);
+    if (g_game) {
+        Lua_PushInstance(L, g_game);
+        lua_setglobal(L, "game");
+        if (g_game->workspace) {
+            Lua_PushInstance(L, g_game->workspace);
+            lua_setglobal(L, "Workspace");
+        }
+    }
+
+    scheduler = std::move(sch);
+    LiveActors().push_back(std::static_pointer_cast<Actor>(shared_from_this()));
+    LOGI("Actor '%s': VM created", Name.c_str());
+    return scheduler.get();
+}
+
+void Actor::Destroy() {
+    if (!Alive) return;
+    // children first: scripts stop themselves on our scheduler
+    Instance::Destroy();
+    if (scheduler) RetiredSchedulers().push_back(std::move(scheduler));
+}
+
+void Actor::StepAll(double now, double dt) {
+    RetiredSchedulers().clear();
+
+    auto& live = LiveActors();
+    if (live.empty()) return;
+
+    // Serial phase: full DataModel access, one VM at a time.
+    // Index loop: scripts may create new actors while we step.
+    for (size_t i = 0; i < live.size(); ++i) {
+        auto a = live[i].lock();
+        if (a && a->scheduler) a->scheduler->Step(now, dt);
+    }
+
+    // Drop dead entries and collect the VMs with desynchronized threads
+    std::vector<LuaScheduler*> parallel;
+    std::vector<std::shared_ptr<Actor>> keep; // hold actors alive across the parallel phase
+    size_t w = 0;
+    for (size_t i = 0; i < live.size(); ++i) {
+        auto a = live[i].lock();
+        if (!a || !a->scheduler) continue;
+        live[w++] = live[i];
+        if (a->scheduler->HasParallelWork()) {
+            parallel.push_back(a->scheduler.get());
+            keep.push_back(std::move(a));
+        }
+    }
+    live.resize(w);
+
+    // Parallel phase: the main thread blocks here, so the DataModel is a stable snapshot
+    WorkerPool::Get().ParallelFor(parallel.size(), [&](size_t i) {
+        parallel[i]->RunParallelPhase(now);
+    });
+}
+
+void Actor::StepGcAll(double frameDeadline) {
+    for (auto& w : LiveActors()) {
+        // each VM's budget starts from what the ones before it left
+        const double now = EngineClock::Wall();
+        if (now >= frameDeadline) break;
+        auto a = w.lock();
+        if (a && a->scheduler) a->scheduler->StepGc(now, frameDeadline);
+    }
+}
@@ -0,0 +1,34 @@
+// instances/Actor.h
+#pragma once
+#include "bootstrap/Instance.h"
+#include "bootstrap/LuaScheduler.h"
+#include <memory>
+#include <string>
+
+// Scripts parented under an Actor run in a VM owned by that actor instead of
+// the game's main VM, so their desynchronized work can run on the worker pool.
+struct Actor : Instance {
+    explicit Actor(std::string name = "Actor");
+    ~Actor() override;
+
+    // Clones get their own VM, never the source actor's
+    Actor(const Actor& other) : Instance(other) {}
+    Actor& operator=(const Actor& other) { Instance::operator=(other); return *this; }
+
+    void Destroy() override;
+
+    // Creates the VM on first use
+    LuaScheduler* GetScheduler();
+    // Existing VM or nullptr
+    LuaScheduler* Scheduler() const { return scheduler.get(); }
+
+    // Called once per frame after the main scheduler: serial step of every actor VM
+    // on this thread, then their parallel phases on the worker pool.
+    static void StepAll(double now, double dt);
+    // Runs every actor VM's GC pacer against the same frame deadline, in turn, until
+    // the deadline is reached
+    static void StepGcAll(double frameDeadline);
+
+private:
+    std::unique_ptr<LuaScheduler> scheduler;
+};
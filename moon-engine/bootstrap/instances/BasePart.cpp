@@ -1,6 +1,7 @@
 #include "bootstrap/instances/BasePart.h"
 #include "core/logging/Logging.h"
 #include "core/datatypes/Enum.h"
+#include "bootstrap/PartBounds.h"
 #include <cstring>
 #include <cmath>
 
@@ -15,6 +16,12 @@ BasePart::BasePart(std::string name, InstanceClass cls)
 
 BasePart::~BasePart() = default;
 
+void BasePart::MarkRenderDirty() {
+    if (!Proxy.cache || Proxy.queued) return;
+    Proxy.queued = true;
+    Proxy.cache->MarkDirty(Proxy.row);
+}
+
 bool BasePart::LuaGet(lua_State* L, const char* key) const {
     if (std::strcmp(key, "CFrame") == 0) {
         lb::push(L, CF);
@@ -42,17 +49,14 @@ bool BasePart::LuaGet(lua_State* L, const char* key) const {
         lb::push(L, Color3{ Color.r, Color.g, Color.b });
         return true;
     }
+    if (std::strcmp(key, "CastShadow") == 0) {
+        lua_pushboolean(L, CastShadow);
+        return true;
+    }
     if (std::strcmp(key, "Shape") == 0) {
         // Return the enum item for the current shape
-        Enum* partTypeEnum = EnumRegistry::Instance().GetEnum("PartType");
-        if (partTypeEnum) {
-            EnumItem* item = partTypeEnum->GetItem(Shape);
-            if (item) {
-                Lua_PushEnumItem(L, item);
-                return true;
-            }
-        }
-        lua_pushnil(L);
+        static const Enum* partTypeEnum = EnumRegistry::Instance().GetEnum("PartType");
+        Lua_PushEnumItem(L, partTypeEnum ? partTypeEnum->GetItem(Shape) : nullptr);
         return true;
     }
     return false;
@@ -62,11 +66,13 @@ bool BasePart::LuaSet(lua_State* L, const char* key, int valueIndex) {
     if (std::strcmp(key, "CFrame") == 0) {
         const auto* cf = lb::check<CFrame>(L, valueIndex);
         CF = *cf;
+        MarkRenderDirty();
         return true;
     }
     if (std::strcmp(key, "Position") == 0) {
         const auto* v = lb::check<Vector3Game>(L, valueIndex);
         CF.p = *v;
+        MarkRenderDirty();
         return true;
     }
     if (std::strcmp(key, "Orientation") == 0) {
@@ -84,40 +90,36 @@ bool BasePart::LuaSet(lua_State* L, const char* key, int valueIndex) {
         }
         
         // replace rotation, keep translation
-        for(int i=0;i<9;i++) CF.R[i] = rot.R[i];
+        CF = CF.withRotationOf(rot);
+        MarkRenderDirty();
         return true;
     }
     if (std::strcmp(key, "Size") == 0) {
         const auto* v = lb::check<Vector3Game>(L, valueIndex);
         Size = v->toRay();
+        MarkRenderDirty();
         return true;
     }
     if (std::strcmp(key, "Transparency") == 0) {
         Transparency = (float)luaL_checknumber(L, valueIndex);
+        MarkRenderDirty();
         return true;
     }
     if (std::strcmp(key, "Color") == 0) {
         const auto* c = lb::check<Color3>(L, valueIndex);
         Color = { c->r, c->g, c->b };
+        MarkRenderDirty();
+        return true;
+    }
+    if (std::strcmp(key, "CastShadow") == 0) {
+        CastShadow = lua_toboolean(L, valueIndex) != 0;
+        MarkRenderDirty();
         return true;
     }
     if (std::strcmp(key, "Shape") == 0) {
-        // Handle enum item input
-        if (lua_istable(L, valueIndex)) {
-            lua_getfield(L, valueIndex, "Value");
-            if (lua_isnumber(L, -1)) {
-                int newShape = (int)lua_tointeger(L, -1);
-                if (newShape >= 0 && newShape <= 4) {
-                    Shape = newShape;
-                    ApplyShapeConstraints();
-                }
-            }
-            lua_pop(L, 1);
-            return true;
-        }
-        // Handle direct integer input
-        else if (lua_isnumber(L, valueIndex)) {
-            int newShape = (int)lua_tointeger(L, valueIndex);
+        // Enum.PartType item or its integer value
+        int newShape = 0;
+        if (Lua_ToEnumValue(L, valueIndex, newShape)) {
             if (newShape >= 0 && newShape <= 4) { // Valid PartType range
                 Shape = newShape;
                 ApplyShapeConstraints();
@@ -150,4 +152,5 @@ void BasePart::ApplyShapeConstraints() {
             // No constraints for these shapes
             break;
     }
+    MarkRenderDirty();
 }
@@ -3,9 +3,11 @@
 #include "core/datatypes/Vector3Game.h"
 #include "core/datatypes/CFrame.h"
 #include "core/datatypes/Color3.h"
+#include <cstdint>
 
 // Forward declare Lua
 struct lua_State;
+struct PartBounds;
 
 struct BasePart : Instance {
     ::Vector3 Size{1.0f,1.0f,1.0f};
@@ -30,6 +32,18 @@ struct BasePart : Instance {
     // Shape property - 0=Ball, 1=Block, 2=Cylinder, 3=Wedge, 4=CornerWedge
     int Shape{1}; // Default to Block
 
+    // Row in the Workspace render proxies (see PartBounds); cache is null outside
+    // the Workspace. Not copied by Clone: a clone gets its own row when parented.
+    struct ProxyLink {
+        PartBounds* cache = nullptr;
+        uint32_t row = 0;
+        bool queued = false;
+        ProxyLink() = default;
+        ProxyLink(const ProxyLink&) {}
+        ProxyLink& operator=(const ProxyLink&) { return *this; }
+    };
+    ProxyLink Proxy;
+
     BasePart(std::string name, InstanceClass cls);
     ~BasePart() override;
 
@@ -38,4 +52,8 @@ struct BasePart : Instance {
     
     // Helper method to apply shape constraints to size
     void ApplyShapeConstraints();
+
+    // Call after writing CF, Size, Color, Shape, Transparency or CastShadow directly
+    // so the renderer refreshes this part's proxy (see PartBounds)
+    void MarkRenderDirty();
 };
@@ -1,9 +1,12 @@
 // instances/BaseScript.cpp
 #include "bootstrap/instances/BaseScript.h"
+#include "bootstrap/instances/Actor.h"
 #include "bootstrap/Game.h"
 #include "bootstrap/LuaScheduler.h"
+#include "bootstrap/ModuleLoader.h"
 #include "bootstrap/ScriptingAPI.h"
 #include "core/logging/Logging.h"
+#include <cstring>
 
 extern std::shared_ptr<Game> g_game;
 
@@ -21,6 +24,10 @@ void BaseScript::SetRunContext(RunContext rc) { Context = rc; }
 RunContext BaseScript::GetRunContext() const { return Context; }
 
 void BaseScript::Schedule() {
+    ScheduleCompiled({});
+}
+
+void BaseScript::ScheduleCompiled(std::string bytecode) {
     if (!Enabled) {
         LOGI("Script '%s' not scheduled (disabled).", Name.c_str());
         return;
@@ -30,11 +37,26 @@ void BaseScript::Schedule() {
         return;
     }
 
+    // Scripts under an Actor run in that actor's VM
+    LuaScheduler* sched = g_game->luaScheduler.get();
+    inActor = false;
+    actor.reset();
+    if (auto a = std::static_pointer_cast<Actor>(FindFirstAncestorOfClass("Actor"))) {
+        sched = a->GetScheduler();
+        if (!sched) return;
+        inActor = true;
+        actor   = a;
+    }
+
     auto selfSp = std::static_pointer_cast<BaseScript>(shared_from_this());
 
-    g_game->luaScheduler->AddScript(
+    // Chunk name the VM's require() can trace back to this script
+    ModuleLoader* modules = ModuleLoader::Get(sched->GetMainState());
+    const std::string chunkName = modules ? modules->ChunkNameFor(selfSp) : Name;
+
+    sched->AddScript(
         selfSp,
-        Name,
+        chunkName,
         GetSource(),
         [selfSp](lua_State* co, BaseScript*) {
             if (g_game && g_game->workspace) Lua_PushInstance(co, g_game->workspace);
@@ -43,15 +65,60 @@ void BaseScript::Schedule() {
 
             Lua_PushInstance(co, selfSp);
             lua_setglobal(co, "script");
-        });
+        },
+        std::move(bytecode));
+}
+
+LuaScheduler* BaseScript::RunningScheduler() const {
+    if (inActor) {
+        auto a = actor.lock();
+        return a ? a->Scheduler() : nullptr;
+    }
+    return (g_game && g_game->luaScheduler) ? g_game->luaScheduler.get() : nullptr;
+}
+
+bool BaseScript::IsRunning() const {
+    auto* sched = RunningScheduler();
+    return sched && sched->GetScriptThread(const_cast<BaseScript*>(this)) != nullptr;
+}
+
+void BaseScript::Stop() {
+    if (auto* sched = RunningScheduler()) sched->StopScript(this);
 }
 
 void BaseScript::Destroy() {
     // Cancel the coroutine if scheduled.
-    if (g_game && g_game->luaScheduler) {
-        auto selfSp = std::static_pointer_cast<BaseScript>(shared_from_this());
-        g_game->luaScheduler->StopScript(selfSp.get());
-    }
+    Stop();
     // Then tear down the instance tree.
     LuaSourceContainer::Destroy();
-}
\ No newline at end of file
+}
+
+bool BaseScript::LuaGet(lua_State* L, const char* key) const {
+    if (std::strcmp(key, "Enabled") == 0) { lua_pushboolean(L, Enabled); return true; }
+    if (std::strcmp(key, "Source") == 0)  { lua_pushlstring(L, Source.c_str(), Source.size()); return true; }
+    // Lua heap charged to this script and its tasks/listeners, in KB
+    if (std::strcmp(key, "MemoryUsage") == 0) {
+        auto* sched = RunningScheduler();
+        lua_pushnumber(L, sched ? sched->GetScriptMemory(const_cast<BaseScript*>(this)) / 1024.0 : 0.0);
+        return true;
+    }
+    return Instance::LuaGet(L, key);
+}
+
+bool BaseScript::LuaSet(lua_State* L, const char* key, int valueIndex) {
+    if (std::strcmp(key, "Source") == 0) {
+        size_t len = 0;
+        const char* src = luaL_checklstring(L, valueIndex, &len);
+        SetSource(std::string(src, len));
+        return true;
+    }
+    // Enabling a script that isn't running schedules it (in its Actor's VM if it has one)
+    if (std::strcmp(key, "Enabled") == 0) {
+        const bool on = lua_toboolean(L, valueIndex) != 0;
+        Enabled = on;
+        if (on && !IsRunning()) Schedule();
+        else if (!on) Stop();
+        return true;
+    }
+    return Instance::LuaSet(L, key, valueIndex);
+}
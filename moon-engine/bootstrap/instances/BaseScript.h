@@ -1,6 +1,10 @@
 // instances/BaseScript.h
 #pragma once
 #include "LuaSourceContainer.h"
+#include <memory>
+
+struct Actor;
+class LuaScheduler;
 
 enum class RunContext { Server, Client, Plugin };
 
@@ -19,4 +23,19 @@ struct BaseScript : LuaSourceContainer {
     RunContext GetRunContext() const;
 
     virtual void Schedule();
+    // Schedule with bytecode already compiled from the current Source (hot reload)
+    void ScheduleCompiled(std::string bytecode);
+    void Stop();
+    bool IsRunning() const;
+
+    bool LuaGet(lua_State* L, const char* key) const override;
+    bool LuaSet(lua_State* L, const char* key, int valueIndex) override;
+
+    // Scheduler this script was handed to (main VM, or its Actor's VM)
+    LuaScheduler* RunningScheduler() const;
+
+private:
+
+    bool                 inActor{false};
+    std::weak_ptr<Actor> actor;
 };
\ No newline at end of file
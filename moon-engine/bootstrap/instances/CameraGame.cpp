@@ -104,8 +104,7 @@ bool CameraGame::LuaSet(lua_State* L, const char* k, int idx) {
     
     // Handle CameraGame-specific properties
     if (strcmp(k, "CFrame") == 0) {
-        if (lb::luaL_testudata(L, idx, lb::Traits<CFrame>::MetaName())) {
-            const auto* cf = lb::check<CFrame>(L, idx);
+        if (const auto* cf = lb::test<CFrame>(L, idx)) {
             CFrameValue = *cf;
             // Update legacy Position and Target for compatibility
             Position = cf->p.toRay();
@@ -115,15 +114,14 @@ bool CameraGame::LuaSet(lua_State* L, const char* k, int idx) {
         }
     }
     if (strcmp(k, "Focus") == 0) {
-        if (lb::luaL_testudata(L, idx, lb::Traits<CFrame>::MetaName())) {
-            const auto* cf = lb::check<CFrame>(L, idx);
+        if (const auto* cf = lb::test<CFrame>(L, idx)) {
             Focus = *cf;
             NotifyPropertyChanged();
             return true;
         }
     }
     if (strcmp(k, "Position") == 0) {
-        if (lb::luaL_testudata(L, idx, lb::Traits<Vector3Game>::MetaName())) {
+        if (lua_isvector(L, idx)) {
             const auto* pos = lb::check<Vector3Game>(L, idx);
             Position = pos->toRay();
             // Update CFrame position while preserving rotation
@@ -133,7 +131,7 @@ bool CameraGame::LuaSet(lua_State* L, const char* k, int idx) {
         }
     }
     if (strcmp(k, "Target") == 0) {
-        if (lb::luaL_testudata(L, idx, lb::Traits<Vector3Game>::MetaName())) {
+        if (lua_isvector(L, idx)) {
             const auto* target = lb::check<Vector3Game>(L, idx);
             Target = target->toRay();
             // Update CFrame to look at target
@@ -8,4 +8,5 @@
 #include "bootstrap/instances/Script.h"
 #include "bootstrap/instances/LocalScript.h"
 #include "bootstrap/instances/Sky.h"
-// #include "bootstrap/instances/ModuleScript.h"
+#include "bootstrap/instances/Actor.h"
+#include "bootstrap/instances/ModuleScript.h"
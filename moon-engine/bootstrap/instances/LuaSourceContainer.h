@@ -6,6 +6,7 @@
 
 struct LuaSourceContainer : Instance {
     std::string Source;
+    std::string SourcePath;  // file the source came from (--path), empty for in-place scripts
 
     explicit LuaSourceContainer(std::string name, InstanceClass cls)
         : Instance(std::move(name), cls) {}
@@ -430,7 +430,17 @@ bool MeshPart::createRaylibMesh(const std::vector<Vector3>& vertices,
     if (MeshSize.x < 0.1f) MeshSize.x = 0.1f;
     if (MeshSize.y < 0.1f) MeshSize.y = 0.1f;
     if (MeshSize.z < 0.1f) MeshSize.z = 0.1f;
-    
+
+    // Headless: no GL context, keep the measured size and drop the CPU-side mesh
+    if (!IsWindowReady()) {
+        MemFree(mesh.vertices);
+        MemFree(mesh.normals);
+        MemFree(mesh.texcoords);
+        LOGI("MeshPart '%s': headless, skipped GPU upload (MeshSize = %.2f, %.2f, %.2f)",
+             Name.c_str(), MeshSize.x, MeshSize.y, MeshSize.z);
+        return true;
+    }
+
     // Upload mesh to GPU
     GenMeshTangents(&mesh);
     UploadMesh(&mesh, false);
@@ -476,6 +486,7 @@ bool MeshPart::loadTexture() {
         LOGI("MeshPart '%s': No TextureID specified", Name.c_str());
         return false;
     }
+    if (!IsWindowReady()) return false; // headless, nothing to upload to
 
     LOGI("MeshPart '%s': Loading texture '%s'", Name.c_str(), TextureID.c_str());
 
@@ -123,6 +123,7 @@ void ModelInstance::PivotTo(const CFrame& targetCFrame) {
     if (auto primaryPart = PrimaryPart.lock()) {
         // Move primary part
         primaryPart->CF = targetCFrame;
+        primaryPart->MarkRenderDirty();
     } else {
         // Set world pivot
         WorldPivot = targetCFrame;
@@ -160,8 +161,7 @@ bool ModelInstance::LuaSet(lua_State* L, const char* key, int valueIndex) {
         if (lua_isnil(L, valueIndex)) {
             PrimaryPart.reset();
         } else {
-            auto* inst_ptr = static_cast<std::shared_ptr<Instance>*>(
-                luaL_checkudata(L, valueIndex, "Librebox.Instance"));
+            auto* inst_ptr = Lua_CheckInstance(L, valueIndex);
             if (inst_ptr && *inst_ptr) {
                 if (auto part = std::dynamic_pointer_cast<BasePart>(*inst_ptr)) {
                     // Check if part is a descendant of this model
@@ -224,6 +224,7 @@ void ModelInstance::updateChildrenTransforms(const CFrame& oldPivot, const CFram
                 relativePos = relativePos * static_cast<float>(scaleRatio);
                 part->CF.p = newPivot.p + relativePos;
             }
+            part->MarkRenderDirty();
         }
     }
 }
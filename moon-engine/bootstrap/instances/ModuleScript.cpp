@@ -0,0 +1,42 @@
+// instances/ModuleScript.cpp
+#include "bootstrap/instances/ModuleScript.h"
+#include "core/logging/Logging.h"
+#include "bootstrap/Instance.h"
+#include <cstring>
+#include <utility>
+
+// Luau
+#include "lua.h"
+#include "lualib.h"
+
+static Instance::Registrar _reg_modulescript("ModuleScript", [] {
+    return std::make_shared<ModuleScript>("ModuleScript");
+});
+
+ModuleScript::ModuleScript(std::string name)
+    : LuaSourceContainer(std::move(name), InstanceClass::ModuleScript) {
+    LOGI("ModuleScript created '%s'", Name.c_str());
+}
+
+ModuleScript::ModuleScript(std::string name, std::string source)
+    : ModuleScript(std::move(name)) {
+    SetSource(std::move(source));
+}
+
+ModuleScript::~ModuleScript() { LOGI("~ModuleScript '%s'", Name.c_str()); }
+
+bool ModuleScript::LuaGet(lua_State* L, const char* key) const {
+    if (std::strcmp(key, "Source") == 0) { lua_pushlstring(L, Source.c_str(), Source.size()); return true; }
+    return Instance::LuaGet(L, key);
+}
+
+// Editing Source does not touch modules that already ran; the cached result stays
+bool ModuleScript::LuaSet(lua_State* L, const char* key, int valueIndex) {
+    if (std::strcmp(key, "Source") == 0) {
+        size_t len = 0;
+        const char* src = luaL_checklstring(L, valueIndex, &len);
+        SetSource(std::string(src, len));
+        return true;
+    }
+    return Instance::LuaSet(L, key, valueIndex);
+}
@@ -0,0 +1,15 @@
+// instances/ModuleScript.h
+#pragma once
+#include "LuaSourceContainer.h"
+#include <string>
+
+// Never scheduled; its source runs once per VM, the first time it is required,
+// and every later require() gets the cached return value.
+struct ModuleScript : LuaSourceContainer {
+    explicit ModuleScript(std::string name = "ModuleScript");
+    ModuleScript(std::string name, std::string source);
+    ~ModuleScript() override;
+
+    bool LuaGet(lua_State* L, const char* key) const override;
+    bool LuaSet(lua_State* L, const char* key, int valueIndex) override;
+};
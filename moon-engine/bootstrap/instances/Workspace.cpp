@@ -21,6 +21,7 @@ Workspace::Workspace(std::string name)
             auto basePart = std::dynamic_pointer_cast<BasePart>(c);
             if (basePart) {
                 parts.push_back(basePart);
+                bounds.Add(*basePart);
             }
         } else if (c->Class == InstanceClass::Camera) {
             auto cameraInstance = std::static_pointer_cast<CameraGame>(c);
@@ -36,7 +37,10 @@ Workspace::Workspace(std::string name)
             auto basePart = std::dynamic_pointer_cast<BasePart>(c);
             if (basePart) {
                 auto it = std::find(parts.begin(), parts.end(), basePart);
-                if (it != parts.end()) { *it = parts.back(); parts.pop_back(); }
+                if (it != parts.end()) {
+                    bounds.Remove(*basePart);
+                    *it = parts.back(); parts.pop_back();
+                }
             }
         } else if (c->Class == InstanceClass::Camera) {
             auto cameraInstance = std::static_pointer_cast<CameraGame>(c);
@@ -46,7 +50,10 @@ Workspace::Workspace(std::string name)
         }
     });
 }
-Workspace::~Workspace() = default;
+Workspace::~Workspace() {
+    // Parts can outlive us through script references
+    for (auto& p : parts) if (p) bounds.Detach(*p);
+}
 
 // Static function for Raycast Lua binding
 static int WorkspaceRaycast(lua_State* L) {
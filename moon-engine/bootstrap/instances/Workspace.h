@@ -1,6 +1,7 @@
 #pragma once
 #include "bootstrap/services/Service.h"
 #include "core/datatypes/Vector3Game.h"
+#include "bootstrap/PartBounds.h"
 #include <vector>
 #include <memory>
 
@@ -29,6 +30,7 @@ struct RaycastResult {
 struct Workspace : Service {
     std::shared_ptr<CameraGame> camera; // CurrentCamera
     std::vector<std::shared_ptr<BasePart>> parts;
+    PartBounds bounds; // render proxies, one row per part
 
     explicit Workspace(std::string name = "Workspace");
     ~Workspace() override;
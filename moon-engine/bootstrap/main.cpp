@@ -15,17 +15,24 @@
 #include "bootstrap/services/UserInputService.h"
 #include "bootstrap/services/TweenService.h"
 #include "bootstrap/gui/GuiManager.h"
+#include "bootstrap/EngineClock.h"
+#include "bootstrap/ScriptWatcher.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <filesystem>
 #include <string>
+#include <thread>
 #include <vector>
 #include "icon.h"
 #include "icon_ico_file.h"
 #include "place_file.h"
 #include "preloaded_scripts.h"
 
+#ifdef _WIN32
 // avoid Win32 name collisions
 #define WIN32_LEAN_AND_MEAN
 #define CloseWindow Win32CloseWindow
@@ -37,9 +44,11 @@
 #undef DrawTextEx
 #undef CloseWindow
 #undef ShowCursor
+#endif
 
 static Camera3D g_camera{};
 static std::unique_ptr<GuiManager> g_guiManager;
+static std::unique_ptr<ScriptWatcher> g_scriptWatcher; // --watch
 
 // yaw/pitch state
 static float gYaw = 0.0f;
@@ -48,6 +57,13 @@ static bool gAnglesInit = false;
 static int gTargetFPS = 0;
 static std::vector<std::string> gPaths;
 static bool gNoPlace = false;
+static double gScriptTimeoutMs = -1.0; // <0 keeps the scheduler default
+static bool gHeadless = false;          // no window, GUI or renderer
+static uint64_t gFrames = 0;            // headless frame count, 0 = run until killed
+static std::string gClockMode = "real"; // real | fixed | accel
+static double gTimestepMs = 0.0;        // fixed clock step, 0 = 1 / target FPS
+static double gTimeScale = 1.0;         // accelerated clock multiplier
+static bool gWatch = false;             // hot reload --path scripts
 static bool args = false;
 
 static void PhysicsSimulation() {
@@ -138,13 +154,36 @@ static void Stage_ConfigInitialization() {
     LogBoth("Loaded configuration");
 }
 
-static void LoadAndScheduleScript(const std::string& name, const std::string& path) {
+// Installs the clock picked with --clock before anything schedules against it.
+static bool Stage_ClockInitialization() {
+    if (gClockMode == "real") {
+        return true; // default clock
+    }
+    if (gClockMode == "fixed") {
+        const double step = gTimestepMs > 0.0 ? gTimestepMs / 1000.0
+                                              : 1.0 / (gTargetFPS > 0 ? gTargetFPS : 60);
+        EngineClock::Set(std::make_unique<FixedStepClock>(step));
+        LOGI("Clock: fixed step %.3f ms", step * 1000.0);
+        return true;
+    }
+    if (gClockMode == "accel" || gClockMode == "accelerated") {
+        EngineClock::Set(std::make_unique<AcceleratedClock>(gTimeScale));
+        LOGI("Clock: accelerated x%.2f", gTimeScale);
+        return true;
+    }
+    LOGE("Unknown --clock '%s' (expected real, fixed or accel)", gClockMode.c_str());
+    return false;
+}
+
+static std::shared_ptr<BaseScript> LoadAndScheduleScript(const std::string& name, const std::string& path) {
     auto script = std::make_shared<Script>(name, fsys::ReadFileToString(path));
+    script->SourcePath = path; // require("./x") resolves next to the file
     if (g_game && g_game->workspace) {
         script->SetParent(g_game->workspace);
     }
     script->Schedule();
-    LogBoth("Scheduled script: %s", path.c_str());
+    LOGI("Scheduled script: %s", path.c_str());
+    return script;
 }
 
 static std::filesystem::path GetExecutableDirectory() {
@@ -227,10 +266,9 @@ static bool Preflight_ValidatePaths() {
     return true;
 }
 
-static void Stage_Initialization() {
-    SetTraceLogCallback(RaylibLog);
-    LogBoth("Stage: Initialization begin");
-
+// Window, icon and (unless scripts were given on the command line) the loader menu.
+// Returns the chosen preloaded demo, 0 for none.
+static int Stage_WindowInitialization() {
     InitWindow(1280, 720, "ECLIPSERA ENGINE (LunarEngine 1.0.0 modified)");
 
     // setup icons
@@ -242,6 +280,7 @@ static void Stage_Initialization() {
     icon.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
     SetWindowIcon(icon);
+#ifdef _WIN32
     HICON hIcon = CreateIconFromResourceEx(
         (PBYTE)icon_ico,
         (DWORD)icon_ico_len,
@@ -256,24 +295,42 @@ static void Stage_Initialization() {
         SendMessage(hwnd, WM_SETICON, ICON_BIG, (LPARAM)hIcon);
         SendMessage(hwnd, WM_SETICON, ICON_SMALL, (LPARAM)hIcon);
     }
-
+#endif
 
     LogBoth("Raylib window initialized");
 
-    int selected = 0;
-    
     if (!args) {
-        selected = LoaderMenu();
+        return LoaderMenu();
+    }
+    return 0;
+}
+
+static void Stage_Initialization() {
+    SetTraceLogCallback(RaylibLog);
+    LogBoth("Stage: Initialization begin");
+
+    int selected = 0;
+    if (!gHeadless) {
+        selected = Stage_WindowInitialization();
+    } else {
+        LogBoth("Headless: skipping window, GUI and renderer");
     }
 
     g_game = std::make_shared<Game>();
     g_game->Init();
 
+    if (gScriptTimeoutMs >= 0.0 && g_game->luaScheduler) {
+        g_game->luaScheduler->defaultLimits.maxResumeSeconds = gScriptTimeoutMs / 1000.0;
+        LOGI("Script timeout set to %.0f ms", gScriptTimeoutMs);
+    }
+
     // Initialize GUI Manager BEFORE scheduling any scripts
     // This ensures icons are loaded before scripts start executing
-    g_guiManager = std::make_unique<GuiManager>();
-    g_guiManager->Initialize();
-    LogBoth("GUI Manager initialized (icons loaded before scripts)");
+    if (!gHeadless) {
+        g_guiManager = std::make_unique<GuiManager>();
+        g_guiManager->Initialize();
+        LogBoth("GUI Manager initialized (icons loaded before scripts)");
+    }
 
     // load script if needed
     if (selected > 0) {
@@ -327,19 +384,26 @@ static void Stage_Initialization() {
     }
 
     // Path handling (supports multiple --path)
+    if (gWatch && !gPaths.empty()) {
+        g_scriptWatcher = std::make_unique<ScriptWatcher>(&LoadAndScheduleScript);
+        LogBoth("Hot reload enabled for --path scripts");
+    }
     if (!gPaths.empty()) {
         namespace fs = std::filesystem;
         for (const auto& pathStr : gPaths) {
             fs::path p(pathStr);
             if (fs::exists(p)) {
                 if (fs::is_regular_file(p)) {
-                    LoadAndScheduleScript(p.stem().string(), p.string()); // run regardless of extension
+                    auto script = LoadAndScheduleScript(p.stem().string(), p.string()); // run regardless of extension
+                    if (g_scriptWatcher) g_scriptWatcher->WatchFile(p, script);
                 } else if (fs::is_directory(p)) {
                     for (auto& entry : fs::directory_iterator(p)) {
                         if (entry.is_regular_file() && entry.path().extension() == ".lua") {
-                            LoadAndScheduleScript(entry.path().stem().string(), entry.path().string());
+                            auto script = LoadAndScheduleScript(entry.path().stem().string(), entry.path().string());
+                            if (g_scriptWatcher) g_scriptWatcher->WatchFile(entry.path(), script);
                         }
                     }
+                    if (g_scriptWatcher) g_scriptWatcher->WatchDirectory(p);
                 } else {
                     LOGE("Path is neither file nor directory: %s", pathStr.c_str());
                 }
@@ -352,63 +416,80 @@ static void Stage_Initialization() {
     LogBoth("Stage: Initialization end");
 }
 
+// Services the frame loop drives, resolved once when the loop starts
+struct FrameServices {
+    std::shared_ptr<RunService>       runService;
+    std::shared_ptr<TweenService>     tweens;
+    std::shared_ptr<UserInputService> input;
+
+    static FrameServices Resolve() {
+        FrameServices fs;
+        fs.runService = std::dynamic_pointer_cast<RunService>(Service::Get("RunService"));
+        fs.tweens     = std::dynamic_pointer_cast<TweenService>(Service::Get("TweenService"));
+        fs.input      = std::dynamic_pointer_cast<UserInputService>(Service::Get("UserInputService"));
+        return fs;
+    }
+};
+
+// One simulation frame: RunService events, scripts, actors and tweens.
+// Shared by the windowed and headless loops; render-only events are skipped headless.
+static void StepSimulation(const FrameServices& svc, double now, double dt) {
+    // pick up edited --path scripts before anything runs this frame
+    if (g_scriptWatcher) {
+        g_scriptWatcher->Poll(EngineClock::Wall());
+    }
+
+    const bool scripting = g_game && g_game->luaScheduler;
+    if (svc.runService && scripting) {
+        svc.runService->FirePrePhysics(now, dt, !gHeadless);
+        PhysicsSimulation();
+        svc.runService->FirePostPhysics(dt);
+    }
+
+    EngineClock& clock = EngineClock::Get();
+    if (scripting)
+        g_game->luaScheduler->Step(clock.Now(), dt);
+
+    // Actor VMs: serial step, then desynchronized work on the worker pool
+    Actor::StepAll(clock.Now(), dt);
+
+    if (svc.tweens) {
+        svc.tweens->Update(dt);
+    }
+}
+
+// Spend what's left of the frame on Lua GC (wall time, whatever the clock mode)
+static void StepGarbageCollection(double frameDeadline) {
+    if (g_game && g_game->luaScheduler) {
+        g_game->luaScheduler->StepGc(EngineClock::Wall(), frameDeadline);
+        Actor::StepGcAll(frameDeadline);
+    }
+}
+
 static void Stage_Run() {
     LogBoth("Stage: Run loop begin");
-    auto rs = std::dynamic_pointer_cast<RunService>(Service::Get("RunService"));
-    auto ls = std::dynamic_pointer_cast<Lighting>(Service::Get("Lighting"));
+    const FrameServices svc = FrameServices::Resolve();
 
-    while (!WindowShouldClose()) {
-        const double now = GetTime();
-        const double dt  = GetFrameTime();
-
-        lua_State* Lm = (g_game && g_game->luaScheduler) ? g_game->luaScheduler->GetMainState() : nullptr;
-        if (rs && Lm) {
-            rs->EnsureSignals();
-            if (rs->PreRender && !rs->PreRender->IsClosed()) {
-                lua_pushnumber(Lm, dt);
-                rs->PreRender->Fire(Lm, lua_gettop(Lm), 1);
-                lua_pop(Lm, 1);
-            }
-            if (rs->PreAnimation && !rs->PreAnimation->IsClosed()) {
-                lua_pushnumber(Lm, dt);
-                rs->PreAnimation->Fire(Lm, lua_gettop(Lm), 1);
-                lua_pop(Lm, 1);
-            }
-            if (rs->PreSimulation && !rs->PreSimulation->IsClosed()) {
-                lua_pushnumber(Lm, now);
-                lua_pushnumber(Lm, dt);
-                rs->PreSimulation->Fire(Lm, lua_gettop(Lm)-1, 2);
-                lua_pop(Lm, 2);
-            }
+    // Frame period the GC pacer works against (target FPS, else vsync rate)
+    int frameHz = gTargetFPS > 0 ? gTargetFPS : GetMonitorRefreshRate(GetCurrentMonitor());
+    if (frameHz <= 0) frameHz = 60;
+    const double frameBudget = 1.0 / frameHz;
 
-            PhysicsSimulation();
+    EngineClock& clock = EngineClock::Get();
+    clock.Tick(); // don't hand initialization time to the first frame
 
-            if (rs->PostSimulation && !rs->PostSimulation->IsClosed()) {
-                lua_pushnumber(Lm, dt);
-                rs->PostSimulation->Fire(Lm, lua_gettop(Lm), 1);
-                lua_pop(Lm, 1);
-            }
-            if (rs->Heartbeat && !rs->Heartbeat->IsClosed()) {
-                lua_pushnumber(Lm, dt);
-                rs->Heartbeat->Fire(Lm, lua_gettop(Lm), 1);
-                lua_pop(Lm, 1);
-            }
-        }
-        if (g_game && g_game->luaScheduler)
-            g_game->luaScheduler->Step(GetTime(), dt);
+    while (!WindowShouldClose()) {
+        const double frameStart = EngineClock::Wall();
+        const double dt  = clock.Tick();
+        const double now = clock.Now();
+
+        StepSimulation(svc, now, dt);
 
         // Update UserInputService
         // IM ABOUT TO ROTTING AITHGSFODJgmarzsfoidlkzgj;,rsdfplgl;jars.kzf/dkgpksdzl LET ME fUCKING SLEEEP ALREADY
         // WHY I HAVE TO STAY HERE,  ICOMING HERE AND I CHECK THE SIGNAL I CHECK SCHEDULAR I WANT TO FUCKING KILL MYSELF BROOOOOOOOOOOOOOOOOOOOOOOO LET ME GOO
-        auto uis = std::dynamic_pointer_cast<UserInputService>(Service::Get("UserInputService"));
-        if (uis) {
-            uis->Update();
-        }
-
-        // Update TweenService
-        auto tweenService = std::dynamic_pointer_cast<TweenService>(Service::Get("TweenService"));
-        if (tweenService) {
-            tweenService->Update(dt);
+        if (svc.input) {
+            svc.input->Update();
         }
 
         // Update GUI Manager
@@ -446,14 +527,66 @@ static void Stage_Run() {
             }
         }
         
+        StepGarbageCollection(frameStart + frameBudget);
+
         EndDrawing();
     }
 
     LogBoth("Stage: Run loop end");
 }
 
+// Server / benchmark loop: no window, input, GUI or rendering. The real clock is paced
+// to the target rate; fixed and accelerated clocks run frames back to back.
+static void Stage_RunHeadless() {
+    EngineClock& clock = EngineClock::Get();
+    const int frameHz = gTargetFPS > 0 ? gTargetFPS : 60;
+    const double framePeriod = 1.0 / frameHz;
+    const bool paced = gClockMode == "real";
+
+    if (gFrames) LOGI("Stage: Headless run begin (%s clock, %llu frames)", clock.Name(), (unsigned long long)gFrames);
+    else         LOGI("Stage: Headless run begin (%s clock, until killed)", clock.Name());
+
+    const FrameServices svc = FrameServices::Resolve();
+
+    clock.Tick();
+    const double simStart  = clock.Now();
+    const double wallStart = EngineClock::Wall();
+    double worstFrame = 0.0;
+    uint64_t frame = 0;
+
+    while (gFrames == 0 || frame < gFrames) {
+        const double frameStart = EngineClock::Wall();
+        const double dt  = clock.Tick();
+        const double now = clock.Now();
+
+        StepSimulation(svc, now, dt);
+        StepGarbageCollection(frameStart + framePeriod);
+        ++frame;
+
+        const double spent = EngineClock::Wall() - frameStart;
+        worstFrame = std::max(worstFrame, spent);
+        if (paced && spent < framePeriod) {
+            std::this_thread::sleep_for(std::chrono::duration<double>(framePeriod - spent));
+        }
+    }
+
+    const double wall = EngineClock::Wall() - wallStart;
+    LOGI("Headless: %llu frames, %.3f s simulated in %.3f s wall (%.1f frames/s)",
+            (unsigned long long)frame, clock.Now() - simStart, wall, wall > 0.0 ? frame / wall : 0.0);
+    LOGI("Headless: %.3f ms/frame average, %.3f ms worst",
+            frame ? wall * 1000.0 / frame : 0.0, worstFrame * 1000.0);
+    LogBoth("Stage: Headless run end");
+}
+
 static void Cleanup() {
+    static bool done = false; // also registered with atexit
+    if (done) return;
+    done = true;
     LogBoth("Cleanup begin");
+    if (g_game && g_game->luaScheduler) {
+        g_game->luaScheduler->LogOrphanedConnections();
+    }
+    g_scriptWatcher.reset();
     if (g_guiManager) {
         g_guiManager->Shutdown();
         g_guiManager.reset();
@@ -462,7 +595,9 @@ static void Cleanup() {
         g_game->Shutdown();
         g_game.reset();
     }
-    CloseWindow();
+    if (IsWindowReady()) {
+        CloseWindow();
+    }
     LogBoth("Cleanup end");
 }
 
@@ -473,8 +608,22 @@ int main(int argc, char** argv) {
         } else if (std::strcmp(argv[i], "--path") == 0 && i + 1 < argc) {
             gPaths.push_back(argv[++i]);
             args = true;
+        } else if (std::strcmp(argv[i], "--script-timeout") == 0 && i + 1 < argc) {
+            gScriptTimeoutMs = std::atof(argv[++i]);
         } else if (std::strcmp(argv[i], "--no-place") == 0) {
             gNoPlace = true;
+        } else if (std::strcmp(argv[i], "--watch") == 0) {
+            gWatch = true;
+        } else if (std::strcmp(argv[i], "--headless") == 0) {
+            gHeadless = true;
+        } else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            gFrames = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--clock") == 0 && i + 1 < argc) {
+            gClockMode = argv[++i];
+        } else if (std::strcmp(argv[i], "--timestep") == 0 && i + 1 < argc) {
+            gTimestepMs = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--timescale") == 0 && i + 1 < argc) {
+            gTimeScale = std::atof(argv[++i]);
         } else if (i == 1) {
             // first non-flag argument
             std::string arg = argv[i];
@@ -489,7 +638,12 @@ int main(int argc, char** argv) {
 
     Stage_ConfigInitialization();
 
-    if (!Preflight_ValidateResources()) {
+    if (!Stage_ClockInitialization()) {
+        return EXIT_FAILURE;
+    }
+
+    // headless never touches the textures/fonts in resources/
+    if (!gHeadless && !Preflight_ValidateResources()) {
         return EXIT_FAILURE; // exit if resources are missing
     }
 
@@ -498,13 +652,19 @@ int main(int argc, char** argv) {
     }
 
     LogBoth("-----------------------------");
-    LogBoth("ECLIPSERA ENGINE (Client)");
+    LogBoth(gHeadless ? "ECLIPSERA ENGINE (Server)" : "ECLIPSERA ENGINE (Client)");
     LogBoth("License: MIT license");
     LogBoth("Author: Ghoste, NickiBreeki, LunarEngine Developers");
     LogBoth("-----------------------------");
 
     Stage_Initialization();
 
+    if (gHeadless) {
+        Stage_RunHeadless();
+        Cleanup(); // while the services and loggers are still alive, not from atexit
+        return 0;
+    }
+
     if (gTargetFPS > 0) {
         SetTargetFPS(gTargetFPS);
         LogBoth("Target FPS set to %d", gTargetFPS);
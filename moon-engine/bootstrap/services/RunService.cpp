@@ -6,16 +6,36 @@
 
 extern void Lua_PushSignal(lua_State* L, const std::shared_ptr<RTScriptSignal>& sig);
 
-RunService::RunService() : Service("RunService", InstanceClass::RunService) {}
+RunService::RunService() : Service("RunService", InstanceClass::RunService) {
+    EnsureSignals(); // on the main thread, so reading them from a desynchronized Actor writes nothing
+}
 
 void RunService::EnsureSignals() const {
     auto* self = const_cast<RunService*>(this);
     LuaScheduler* sch = (g_game && g_game->luaScheduler) ? g_game->luaScheduler.get() : nullptr;
-    if (!self->PreRender)      self->PreRender      = std::make_shared<RTScriptSignal>(sch);
-    if (!self->PreAnimation)   self->PreAnimation   = std::make_shared<RTScriptSignal>(sch);
-    if (!self->PreSimulation)  self->PreSimulation  = std::make_shared<RTScriptSignal>(sch);
-    if (!self->PostSimulation) self->PostSimulation = std::make_shared<RTScriptSignal>(sch);
-    if (!self->Heartbeat)      self->Heartbeat      = std::make_shared<RTScriptSignal>(sch);
+    // named only when made: reads (also from the parallel phase) must not write
+    auto make = [sch](std::shared_ptr<RTScriptSignal>& sig, const char* name) {
+        if (sig) return;
+        sig = std::make_shared<RTScriptSignal>(sch);
+        sig->name = name;
+    };
+    make(self->PreRender,      "RunService.PreRender");
+    make(self->PreAnimation,   "RunService.PreAnimation");
+    make(self->PreSimulation,  "RunService.PreSimulation");
+    make(self->PostSimulation, "RunService.PostSimulation");
+    make(self->Heartbeat,      "RunService.Heartbeat");
+}
+
+void RunService::FirePrePhysics(double now, double dt, bool rendering) {
+    if (!Heartbeat) EnsureSignals();
+    if (rendering) PreRender->Emit(dt);
+    PreAnimation->Emit(dt);
+    PreSimulation->Emit(now, dt);
+}
+
+void RunService::FirePostPhysics(double dt) {
+    PostSimulation->Emit(dt);
+    Heartbeat->Emit(dt);
 }
 
 bool RunService::LuaGet(lua_State* L, const char* key) const {
@@ -14,4 +14,10 @@ struct RunService : Service {
     RunService();
     void EnsureSignals() const;
     bool LuaGet(lua_State* L, const char* key) const override;
+
+    // Per-frame event pump, around the physics step. Each phase is one Emit: a phase
+    // nobody listens to pushes nothing, and the arguments are pushed once for all of
+    // its Lua listeners. PreRender is skipped when nothing is rendered.
+    void FirePrePhysics(double now, double dt, bool rendering);
+    void FirePostPhysics(double dt);
 };
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 extern void Lua_PushSignal(lua_State* L, const std::shared_ptr<RTScriptSignal>& sig);
 extern void Lua_PushTween(lua_State* L, const std::shared_ptr<Tween>& tween);
+extern std::shared_ptr<Instance>* Lua_CheckInstance(lua_State* L, int idx);
 
 // Forward declarations for Lua bindings
 struct LuaTweenInfoUD { TweenInfo info; };
@@ -178,6 +179,7 @@ Tween::Tween(std::shared_ptr<Instance> instance, const TweenInfo& tweenInfo,
     
     LuaScheduler* sch = (g_game && g_game->luaScheduler) ? g_game->luaScheduler.get() : nullptr;
     Completed = std::make_shared<RTScriptSignal>(sch);
+    Completed->name = "Tween.Completed";
     
     // Store initial property values
     for (const auto& [propName, targetValue] : targetProperties) {
@@ -355,6 +357,7 @@ void Tween::SetProperty(const std::string& propertyName, const PropertyValue& va
         if (propertyName == "Transparency") {
             if (std::holds_alternative<float>(value)) {
                 basePart->Transparency = std::get<float>(value);
+                basePart->MarkRenderDirty();
             }
             return;
         } else if (propertyName == "Reflectance") {
@@ -380,16 +383,19 @@ void Tween::SetProperty(const std::string& propertyName, const PropertyValue& va
         } else if (propertyName == "Position") {
             if (std::holds_alternative<Vector3Game>(value)) {
                 basePart->CF.p = std::get<Vector3Game>(value);
+                basePart->MarkRenderDirty();
             }
             return;
         } else if (propertyName == "Size") {
             if (std::holds_alternative<Vector3Game>(value)) {
                 basePart->Size = std::get<Vector3Game>(value).toRay();
+                basePart->MarkRenderDirty();
             }
             return;
         } else if (propertyName == "Color") {
             if (std::holds_alternative<Color3>(value)) {
                 basePart->Color = std::get<Color3>(value);
+                basePart->MarkRenderDirty();
             }
             return;
         }
@@ -536,13 +542,13 @@ void TweenService::RemoveTween(Tween* tween) {
 // Static C functions for Lua bindings
 static int l_TweenService_Create(lua_State* L) {
     // TweenService:Create(instance, tweenInfo, properties)
-    auto* inst_ptr = static_cast<std::shared_ptr<Instance>*>(luaL_checkudata(L, 2, "Librebox.Instance"));
+    auto* inst_ptr = Lua_CheckInstance(L, 2);
     if (!inst_ptr || !*inst_ptr) {
         lua_pushnil(L);
         return 1;
     }
     
-    auto* tweenInfoUD = static_cast<LuaTweenInfoUD*>(luaL_checkudata(L, 3, "Librebox.TweenInfo"));
+    auto* tweenInfoUD = static_cast<LuaTweenInfoUD*>(lb::check_tagged(L, 3, lb::UserdataTag::TweenInfo, "TweenInfo"));
     if (!tweenInfoUD) {
         luaL_error(L, "TweenService:Create expects TweenInfo as second argument");
         return 0;
@@ -561,13 +567,11 @@ static int l_TweenService_Create(lua_State* L) {
             if (lua_type(L, -1) == LUA_TNUMBER) {
                 float propValue = (float)lua_tonumber(L, -1);
                 properties[propName] = propValue;
+            } else if (lua_type(L, -1) == LUA_TVECTOR) {
+                properties[propName] = *lb::check<Vector3Game>(L, -1);
             } else if (lua_type(L, -1) == LUA_TUSERDATA) {
-                // Check if it's a Vector3Game
-                if (auto* vec3 = lb::check<Vector3Game>(L, -1)) {
-                    properties[propName] = *vec3;
-                }
                 // Check if it's a Color3
-                else if (auto* color = lb::check<Color3>(L, -1)) {
+                if (auto* color = lb::test<Color3>(L, -1)) {
                     properties[propName] = *color;
                 }
             } else if (lua_type(L, -1) == LUA_TTABLE) {
@@ -1,9 +1,11 @@
 #include "bootstrap/services/UserInputService.h"
 #include "bootstrap/LuaScheduler.h"
+#include "bootstrap/EngineClock.h"
 #include "bootstrap/Game.h"
 #include "core/logging/Logging.h"
 #include "core/datatypes/Enum.h"
 #include "core/datatypes/Vector2.h"
+#include "core/datatypes/Vector3Game.h"
 #include "raylib.h"
 #include "lua.h"
 #include "lualib.h"
@@ -81,21 +83,9 @@ static int IsMouseButtonPressedLua(lua_State* L) {
         return 1;
     }
     
-    // Check if argument is an enum table with Value field
-    if (lua_istable(L, 1)) {
-        lua_getfield(L, 1, "Value");
-        if (lua_isnumber(L, -1)) {
-            int mouseButton = (int)lua_tonumber(L, -1);
-            lua_pop(L, 1);
-            lua_pushboolean(L, uis->IsMouseButtonPressed(mouseButton));
-            return 1;
-        }
-        lua_pop(L, 1);
-    }
-    
-    // Fallback: treat as direct number
-    if (lua_isnumber(L, 1)) {
-        int mouseButton = (int)lua_tonumber(L, 1);
+    // Enum item or its integer value
+    int mouseButton = 0;
+    if (Lua_ToEnumValue(L, 1, mouseButton)) {
         lua_pushboolean(L, uis->IsMouseButtonPressed(mouseButton));
         return 1;
     }
@@ -112,21 +102,9 @@ static int IsKeyDownLua(lua_State* L) {
         return 1;
     }
     
-    // Check if argument is an enum table with Value field
-    if (lua_istable(L, 1)) {
-        lua_getfield(L, 1, "Value");
-        if (lua_isnumber(L, -1)) {
-            int keyCode = (int)lua_tonumber(L, -1);
-            lua_pop(L, 1);
-            lua_pushboolean(L, uis->IsKeyDown(keyCode));
-            return 1;
-        }
-        lua_pop(L, 1);
-    }
-    
-    // Fallback: treat as direct number
-    if (lua_isnumber(L, 1)) {
-        int keyCode = (int)lua_tonumber(L, 1);
+    // Enum.KeyCode item or its integer value
+    int keyCode = 0;
+    if (Lua_ToEnumValue(L, 1, keyCode)) {
         lua_pushboolean(L, uis->IsKeyDown(keyCode));
         return 1;
     }
@@ -135,15 +113,23 @@ static int IsKeyDownLua(lua_State* L) {
     return 1;
 }
 
-UserInputService::UserInputService() : Service("UserInputService", InstanceClass::UserInputService) {}
+UserInputService::UserInputService() : Service("UserInputService", InstanceClass::UserInputService) {
+    EnsureSignals(); // on the main thread, so reading them from a desynchronized Actor writes nothing
+}
 
 void UserInputService::EnsureSignals() const {
     auto* self = const_cast<UserInputService*>(this);
     LuaScheduler* sch = (g_game && g_game->luaScheduler) ? g_game->luaScheduler.get() : nullptr;
-    if (!self->InputBegan)     self->InputBegan     = std::make_shared<RTScriptSignal>(sch);
-    if (!self->InputEnded)     self->InputEnded     = std::make_shared<RTScriptSignal>(sch);
-    if (!self->InputChanged)   self->InputChanged   = std::make_shared<RTScriptSignal>(sch);
-    if (!self->MouseMoved)     self->MouseMoved     = std::make_shared<RTScriptSignal>(sch);
+    // named only when made: reads (also from the parallel phase) must not write
+    auto make = [sch](std::shared_ptr<RTScriptSignal>& sig, const char* name) {
+        if (sig) return;
+        sig = std::make_shared<RTScriptSignal>(sch);
+        sig->name = name;
+    };
+    make(self->InputBegan,   "UserInputService.InputBegan");
+    make(self->InputEnded,   "UserInputService.InputEnded");
+    make(self->InputChanged, "UserInputService.InputChanged");
+    make(self->MouseMoved,   "UserInputService.MouseMoved");
 }
 
 bool UserInputService::LuaGet(lua_State* L, const char* k) const {
@@ -187,16 +173,12 @@ bool UserInputService::LuaGet(lua_State* L, const char* k) const {
     }
 
     if (!strcmp(k, "MouseBehavior")) {
-        // Create MouseBehavior enum item
-        lua_createtable(L, 0, 2);
-        lua_pushstring(L, mouseBehavior == MouseBehavior::Default ? "Default" : 
-                           mouseBehavior == MouseBehavior::LockCenter ? "LockCenter" : "LockCurrentPosition");
-        lua_setfield(L, -2, "Name");
-        lua_pushnumber(L, static_cast<int>(mouseBehavior));
-        lua_setfield(L, -2, "Value");
+        static const Enum* mouseBehaviorEnum = EnumRegistry::Instance().GetEnum("MouseBehavior");
+        Lua_PushEnumItem(L, mouseBehaviorEnum ? mouseBehaviorEnum->GetItem(static_cast<int>(mouseBehavior)) : nullptr);
         return true;
     }
 
+    if (!strcmp(k, "RawInputEvents")) { lua_pushboolean(L, rawInputEvents); return true; }
     if (!strcmp(k, "MouseEnabled"))   { lua_pushboolean(L, true); return true; }
     if (!strcmp(k, "KeyboardEnabled")) { lua_pushboolean(L, true); return true; }
     if (!strcmp(k, "MouseIconEnabled")) { lua_pushboolean(L, !IsCursorHidden()); return true; }
@@ -205,6 +187,11 @@ bool UserInputService::LuaGet(lua_State* L, const char* k) const {
 }
 
 bool UserInputService::LuaSet(lua_State* L, const char* k, int idx) {
+    if (!strcmp(k, "RawInputEvents")) {
+        rawInputEvents = lua_toboolean(L, idx);
+        return true;
+    }
+
     if (!strcmp(k, "MouseIconEnabled")) {
         bool enabled = lua_toboolean(L, idx);
         if (enabled) ShowCursor(); else HideCursor();
@@ -212,24 +199,18 @@ bool UserInputService::LuaSet(lua_State* L, const char* k, int idx) {
     }
     
     if (!strcmp(k, "MouseBehavior")) {
-        if (lua_istable(L, idx)) {
-            lua_getfield(L, idx, "Value");
-            if (lua_isnumber(L, -1)) {
-                int value = (int)lua_tonumber(L, -1);
-                if (value >= 0 && value <= 2) {
-                    MouseBehavior newBehavior = static_cast<MouseBehavior>(value);
-                    if (mouseBehavior != newBehavior) {
-                        mouseBehavior = newBehavior;
-                        if (mouseBehavior == MouseBehavior::LockCurrentPosition) {
-                            lockedMousePosition = GetMousePosition();
-                        } else if (mouseBehavior == MouseBehavior::LockCenter) {
-                            lockedMousePosition = {(float)GetScreenWidth() / 2.0f, (float)GetScreenHeight() / 2.0f};
-                        }
-                        mousePositionLocked = (mouseBehavior != MouseBehavior::Default);
-                    }
+        const EnumItem* item = Lua_ToEnumItem(L, idx);
+        if (item && item->GetValue() >= 0 && item->GetValue() <= 2) {
+            MouseBehavior newBehavior = static_cast<MouseBehavior>(item->GetValue());
+            if (mouseBehavior != newBehavior) {
+                mouseBehavior = newBehavior;
+                if (mouseBehavior == MouseBehavior::LockCurrentPosition) {
+                    lockedMousePosition = GetMousePosition();
+                } else if (mouseBehavior == MouseBehavior::LockCenter) {
+                    lockedMousePosition = {(float)GetScreenWidth() / 2.0f, (float)GetScreenHeight() / 2.0f};
                 }
+                mousePositionLocked = (mouseBehavior != MouseBehavior::Default);
             }
-            lua_pop(L, 1);
         }
         return true;
     }
@@ -237,125 +218,89 @@ bool UserInputService::LuaSet(lua_State* L, const char* k, int idx) {
     return false;
 }
 
-void UserInputService::PushInputObject(lua_State* L, const char* inputType, const char* keyName, Vector2 mousePos) {
-    lua_createtable(L, 0, 4);
-    
-    // UserInputType - get from global Enum table to ensure same instance
-    lua_getglobal(L, "Enum");
-    if (lua_istable(L, -1)) {
-        lua_getfield(L, -1, "UserInputType");
-        if (lua_istable(L, -1)) {
-            lua_getfield(L, -1, inputType);
-            if (!lua_isnil(L, -1)) {
-                // Found the enum item in global table, use it
-                lua_setfield(L, -4, "UserInputType");
-                lua_pop(L, 2); // pop UserInputType table and Enum table
-            } else {
-                // Fallback
-                lua_pop(L, 3); // pop nil, UserInputType table, and Enum table
-                lua_createtable(L, 0, 1);
-                lua_pushstring(L, inputType);
-                lua_setfield(L, -2, "Name");
-                lua_setfield(L, -2, "UserInputType");
-            }
-        } else {
-            lua_pop(L, 2); // pop UserInputType and Enum
-            lua_createtable(L, 0, 1);
-            lua_pushstring(L, inputType);
-            lua_setfield(L, -2, "Name");
-            lua_setfield(L, -2, "UserInputType");
-        }
-    } else {
-        lua_pop(L, 1); // pop Enum
-        lua_createtable(L, 0, 1);
-        lua_pushstring(L, inputType);
-        lua_setfield(L, -2, "Name");
-        lua_setfield(L, -2, "UserInputType");
+// ================== InputObject ==================
+// Plain data behind the userdata; the names point at string literals
+struct InputObjectData {
+    const char* inputType;
+    const char* keyName;
+    InputEvent::Kind state;
+    Vector2     position;
+    Vector2     delta;
+    float       wheel;
+    double      timestamp;
+};
+
+static const char* kInputObjectMeta = "Librebox.InputObject";
+
+// Enum.<enumType>.<item>, resolved when a script reads the field
+static void PushEnumItemByName(lua_State* L, const Enum* enumType, const char* item) {
+    Lua_PushEnumItem(L, enumType ? enumType->GetItem(item) : nullptr);
+}
+
+static int l_inputobject_index(lua_State* L) {
+    auto* io = static_cast<InputObjectData*>(lb::check_tagged(L, 1, lb::UserdataTag::InputObject, "InputObject"));
+    const char* key = luaL_checkstring(L, 2);
+
+    static const Enum* inputTypeEnum  = EnumRegistry::Instance().GetEnum("UserInputType");
+    static const Enum* keyCodeEnum    = EnumRegistry::Instance().GetEnum("KeyCode");
+    static const Enum* inputStateEnum = EnumRegistry::Instance().GetEnum("UserInputState");
+
+    if (!strcmp(key, "UserInputType")) { PushEnumItemByName(L, inputTypeEnum, io->inputType); return 1; }
+    if (!strcmp(key, "KeyCode"))       { PushEnumItemByName(L, keyCodeEnum, *io->keyName ? io->keyName : "Unknown"); return 1; }
+    if (!strcmp(key, "UserInputState")) {
+        const char* state = io->state == InputEvent::Kind::Began ? "Begin"
+                          : io->state == InputEvent::Kind::Ended ? "End" : "Change";
+        PushEnumItemByName(L, inputStateEnum, state);
+        return 1;
     }
-    
-    // KeyCode - only set for keyboard inputs, not mouse buttons
-    if (strlen(keyName) > 0 && strcmp(inputType, "MouseButton") != 0) {
-        lua_getglobal(L, "Enum");
-        if (lua_istable(L, -1)) {
-            lua_getfield(L, -1, "KeyCode");
-            if (lua_istable(L, -1)) {
-                lua_getfield(L, -1, keyName);
-                if (!lua_isnil(L, -1)) {
-                    // Found the enum item in global table, use it
-                    lua_setfield(L, -4, "KeyCode");
-                    lua_pop(L, 2); // pop KeyCode table and Enum table
-                } else {
-                    // Fallback
-                    lua_pop(L, 3); // pop nil, KeyCode table, and Enum table
-                    lua_createtable(L, 0, 1);
-                    lua_pushstring(L, keyName);
-                    lua_setfield(L, -2, "Name");
-                    lua_setfield(L, -2, "KeyCode");
-                }
-            } else {
-                lua_pop(L, 2); // pop KeyCode and Enum
-                lua_createtable(L, 0, 1);
-                lua_pushstring(L, keyName);
-                lua_setfield(L, -2, "Name");
-                lua_setfield(L, -2, "KeyCode");
-            }
+    if (!strcmp(key, "Position"))  { lb::push(L, Vector3Game{io->position.x, io->position.y, io->wheel}); return 1; }
+    if (!strcmp(key, "Delta"))     { lb::push(L, Vector3Game{io->delta.x, io->delta.y, 0.0f}); return 1; }
+    if (!strcmp(key, "Timestamp")) { lua_pushnumber(L, io->timestamp); return 1; }
+
+    lua_pushnil(L);
+    return 1;
+}
+
+static int l_inputobject_tostring(lua_State* L) {
+    lua_pushliteral(L, "InputObject");
+    return 1;
+}
+
+static InputObjectData* NewInputObject(lua_State* L) {
+    if (luaL_newmetatable(L, kInputObjectMeta)) {
+        lua_pushcfunction(L, l_inputobject_index, "__index");       lua_setfield(L, -2, "__index");
+        lua_pushcfunction(L, l_inputobject_tostring, "__tostring"); lua_setfield(L, -2, "__tostring");
+        lua_pushstring(L, "InputObject");                            lua_setfield(L, -2, "__type");
+        lb::set_tag_metatable(L, lb::UserdataTag::InputObject);
+    }
+    lua_pop(L, 1);
+    return static_cast<InputObjectData*>(lb::new_tagged(L, sizeof(InputObjectData), lb::UserdataTag::InputObject));
+}
+
+// Pushes the InputObject for 'e': the pooled one for that input, or a new one for raw events
+void UserInputService::PushInputObject(lua_State* L, const InputEvent& e) {
+    InputObjectData* io = nullptr;
+    if (!rawInputEvents) {
+        const auto key = std::make_pair(e.inputType, e.keyName);
+        auto it = inputObjects.find(key);
+        if (it != inputObjects.end()) {
+            lua_getref(L, it->second);
+            io = static_cast<InputObjectData*>(lua_touserdata(L, -1));
         } else {
-            lua_pop(L, 1); // pop Enum
-            lua_createtable(L, 0, 1);
-            lua_pushstring(L, keyName);
-            lua_setfield(L, -2, "Name");
-            lua_setfield(L, -2, "KeyCode");
+            io = NewInputObject(L);
+            inputObjects.emplace(key, lua_ref(L, -1));
         }
     } else {
-        // For mouse buttons or empty keyName, set KeyCode to Unknown
-        lua_getglobal(L, "Enum");
-        if (lua_istable(L, -1)) {
-            lua_getfield(L, -1, "KeyCode");
-            if (lua_istable(L, -1)) {
-                lua_getfield(L, -1, "Unknown");
-                if (!lua_isnil(L, -1)) {
-                    lua_setfield(L, -4, "KeyCode");
-                    lua_pop(L, 2); // pop KeyCode table and Enum table
-                } else {
-                    lua_pop(L, 3); // pop nil, KeyCode table, and Enum table
-                    lua_createtable(L, 0, 1);
-                    lua_pushstring(L, "Unknown");
-                    lua_setfield(L, -2, "Name");
-                    lua_setfield(L, -2, "KeyCode");
-                }
-            } else {
-                lua_pop(L, 2); // pop KeyCode and Enum
-                lua_createtable(L, 0, 1);
-                lua_pushstring(L, "Unknown");
-                lua_setfield(L, -2, "Name");
-                lua_setfield(L, -2, "KeyCode");
-            }
-        } else {
-            lua_pop(L, 1); // pop Enum
-            lua_createtable(L, 0, 1);
-            lua_pushstring(L, "Unknown");
-            lua_setfield(L, -2, "Name");
-            lua_setfield(L, -2, "KeyCode");
-        }
-    }
-    
-    // Position
-    lua_createtable(L, 0, 2);
-    lua_pushnumber(L, mousePos.x);
-    lua_setfield(L, -2, "X");
-    lua_pushnumber(L, mousePos.y);
-    lua_setfield(L, -2, "Y");
-    lua_setfield(L, -2, "Position");
-    
-    // Delta - only for mouse movement inputs
-    if (strcmp(inputType, "MouseMovement") == 0) {
-        lua_createtable(L, 0, 2);
-        lua_pushnumber(L, mouseDelta.x);
-        lua_setfield(L, -2, "X");
-        lua_pushnumber(L, mouseDelta.y);
-        lua_setfield(L, -2, "Y");
-        lua_setfield(L, -2, "Delta");
+        io = NewInputObject(L);
     }
+
+    io->inputType = e.inputType;
+    io->keyName   = e.keyName;
+    io->state     = e.kind;
+    io->position  = e.position;
+    io->delta     = e.delta;
+    io->wheel     = e.wheel;
+    io->timestamp = e.timestamp;
 }
 
 void UserInputService::ApplyMouseBehavior() {
@@ -364,7 +309,12 @@ void UserInputService::ApplyMouseBehavior() {
     }
 }
 
+void UserInputService::QueueInput(const InputEvent& e) {
+    inputQueue.push_back(e);
+}
+
 void UserInputService::Update() {
+    const double now = EngineClock::Wall();
     Vector2 mousePos = GetMousePosition();
     
     // Calculate mouse delta before applying mouse behavior
@@ -387,82 +337,97 @@ void UserInputService::Update() {
     // Update mousePos after applying behavior for position-based events
     mousePos = GetMousePosition();
 
-    // Handle mouse movement
-    if (lastMouseX != mousePos.x || lastMouseY != mousePos.y) {
-        if (MouseMoved) {
-            lua_State* L = g_game->luaScheduler->GetMainState();
-            int top = lua_gettop(L);  // Save current stack top
-            PushInputObject(L, "MouseMovement", "", mousePos);
-            MouseMoved->Fire(L, top + 1, 1);  // Use absolute indices from saved top
-            lua_settop(L, top);  // Restore stack
-        }
+    InputEvent e;
+    e.position  = mousePos;
+    e.timestamp = now;
+
+    // Mouse movement (a locked mouse doesn't move, but still has a delta)
+    if (lastMouseX != mousePos.x || lastMouseY != mousePos.y || mouseDelta.x != 0 || mouseDelta.y != 0) {
+        InputEvent m = e;
+        m.inputType = "MouseMovement";
+        m.delta     = mouseDelta;
+        QueueInput(m);
         lastMouseX = mousePos.x;
         lastMouseY = mousePos.y;
     }
 
-    // Handle keyboard
+    if (const float wheel = GetMouseWheelMove(); wheel != 0.0f) {
+        InputEvent w = e;
+        w.inputType = "MouseWheel";
+        w.wheel     = wheel;
+        QueueInput(w);
+    }
+
+    // Keyboard (held-key repeats are not input events)
+    e.inputType = "Keyboard";
     for (const auto& [key, name] : keyNameMap) {
-        if (IsKeyPressed(key)) {
-            if (InputBegan) {
-                lua_State* L = g_game->luaScheduler->GetMainState();
-                if (L) {
-                    int top = lua_gettop(L);  // Save current stack top
-                    PushInputObject(L, "Keyboard", name, mousePos);
-                    lua_pushboolean(L, false);
-                    InputBegan->Fire(L, top + 1, 2);  // Use absolute indices from saved top
-                    lua_settop(L, top);  // Restore stack
-                }
-            }
-        }
-        if (IsKeyReleased(key)) {
-            if (InputEnded) {
-                lua_State* L = g_game->luaScheduler->GetMainState();
-                int top = lua_gettop(L);  // Save current stack top
-                PushInputObject(L, "Keyboard", name, mousePos);
-                lua_pushboolean(L, false);
-                InputEnded->Fire(L, top + 1, 2);  // Use absolute indices from saved top
-                lua_settop(L, top);  // Restore stack
-            }
-        }
+        e.keyName = name;
+        if (IsKeyPressed(key))  { e.kind = InputEvent::Kind::Began; QueueInput(e); }
+        if (IsKeyReleased(key)) { e.kind = InputEvent::Kind::Ended; QueueInput(e); }
     }
 
-    // Handle mouse buttons
+    // Mouse buttons
+    static const char* const buttonNames[3] = { "MouseButton1", "MouseButton2", "MouseButton3" };
+    e.keyName = "";
     for (int button = 0; button < 3; button++) {
-        if (IsMouseButtonPressed(button)) {
-            if (InputBegan) {
-                lua_State* L = g_game->luaScheduler->GetMainState();
-                int top = lua_gettop(L);  // Save current stack top
-                const char* buttonName;
-                switch (button) {
-                    case 0: buttonName = "MouseButton1"; break;
-                    case 1: buttonName = "MouseButton2"; break;
-                    case 2: buttonName = "MouseButton3"; break;
-                    default: buttonName = "Unknown"; break;
-                }
-                PushInputObject(L, buttonName, "", mousePos);
-                lua_pushboolean(L, false);
-                InputBegan->Fire(L, top + 1, 2);  // Use absolute indices from saved top
-                lua_settop(L, top);  // Restore stack
+        e.inputType = buttonNames[button];
+        if (IsMouseButtonPressed(button))  { e.kind = InputEvent::Kind::Began; QueueInput(e); }
+        if (IsMouseButtonReleased(button)) { e.kind = InputEvent::Kind::Ended; QueueInput(e); }
+    }
+
+    DispatchInput();
+}
+
+void UserInputService::DispatchInput() {
+    if (inputQueue.empty()) return;
+
+    // whatever a listener queues goes out next frame
+    dispatching.swap(inputQueue);
+
+    if (!rawInputEvents) {
+        // A Changed event folds into the previous Changed event of the same input, as
+        // long as no Began/Ended came in between: latest position, summed delta.
+        size_t out = 0, runStart = 0;
+        for (size_t i = 0; i < dispatching.size(); ++i) {
+            const InputEvent& ev = dispatching[i];
+            if (ev.kind != InputEvent::Kind::Changed) {
+                dispatching[out++] = ev;
+                runStart = out;
+                continue;
             }
-        }
-        if (IsMouseButtonReleased(button)) {
-            if (InputEnded) {
-                lua_State* L = g_game->luaScheduler->GetMainState();
-                int top = lua_gettop(L);  // Save current stack top
-                const char* buttonName;
-                switch (button) {
-                    case 0: buttonName = "MouseButton1"; break;
-                    case 1: buttonName = "MouseButton2"; break;
-                    case 2: buttonName = "MouseButton3"; break;
-                    default: buttonName = "Unknown"; break;
-                }
-                PushInputObject(L, buttonName, "", mousePos);
-                lua_pushboolean(L, false);
-                InputEnded->Fire(L, top + 1, 2);  // Use absolute indices from saved top
-                lua_settop(L, top);  // Restore stack
+            InputEvent* into = nullptr;
+            for (size_t j = runStart; j < out; ++j) {
+                if (!strcmp(dispatching[j].inputType, ev.inputType)) { into = &dispatching[j]; break; }
             }
+            if (!into) { dispatching[out++] = ev; continue; }
+            into->position  = ev.position;
+            into->delta.x  += ev.delta.x;
+            into->delta.y  += ev.delta.y;
+            into->wheel    += ev.wheel;
+            into->timestamp = ev.timestamp;
         }
+        dispatching.resize(out);
+    }
+
+    lua_State* L = (g_game && g_game->luaScheduler) ? g_game->luaScheduler->GetMainState() : nullptr;
+    for (const auto& ev : dispatching) {
+        RTScriptSignal* sig = ev.kind == InputEvent::Kind::Began ? InputBegan.get()
+                            : ev.kind == InputEvent::Kind::Ended ? InputEnded.get()
+                            : InputChanged.get();
+        const bool toSig   = sig && sig->HasLuaListeners();
+        const bool toMoved = MouseMoved && MouseMoved->HasLuaListeners()
+                          && ev.kind == InputEvent::Kind::Changed && !strcmp(ev.inputType, "MouseMovement");
+        // no InputObject for an event nobody listens to
+        if (!L || (!toSig && !toMoved)) continue;
+
+        const int top = lua_gettop(L);
+        PushInputObject(L, ev);
+        lua_pushboolean(L, false); // gameProcessedEvent
+        if (toMoved) MouseMoved->Fire(L, top + 1, 1);
+        if (toSig)   sig->Fire(L, top + 1, 2);
+        lua_settop(L, top);
     }
+    dispatching.clear();
 }
 
 // Implementation of input state checking methods
@@ -1,7 +1,10 @@
 #pragma once
 #include "bootstrap/services/Service.h"
 #include "bootstrap/signals/Signal.h"
+#include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 #include "raylib.h"
 
 enum class MouseBehavior {
@@ -10,6 +13,20 @@ enum class MouseBehavior {
     LockCurrentPosition = 2
 };
 
+// One input as the platform reported it. Names are Enum.UserInputType / Enum.KeyCode item
+// names and must be string literals: they outlive the event and the InputObject pool is
+// keyed by their addresses. The timestamp is EngineClock::Wall().
+struct InputEvent {
+    enum class Kind { Began, Changed, Ended };
+    Kind        kind      = Kind::Changed;
+    const char* inputType = "None";
+    const char* keyName   = "";
+    Vector2     position  = {0, 0};
+    Vector2     delta     = {0, 0};
+    float       wheel     = 0.0f;   // MouseWheel: Position.Z, as on Roblox
+    double      timestamp = 0.0;
+};
+
 class UserInputService : public Service {
 public:
     UserInputService();
@@ -18,6 +35,14 @@ public:
     bool LuaSet(lua_State* L, const char* k, int idx) override;
     void Update();
 
+    // Input producers add events here; Update polls raylib into the same queue and then
+    // dispatches it. By default the continuous inputs of a frame (MouseMovement,
+    // MouseWheel) are coalesced into one event carrying the latest position and the summed
+    // delta, and every input reuses one InputObject. Scripts that want each event as it
+    // came, with its own InputObject, set UserInputService.RawInputEvents = true.
+    void QueueInput(const InputEvent& e);
+    bool rawInputEvents = false;
+
     // Input state checking methods
     bool IsMouseButtonPressed(int mouseButton) const;
     bool IsKeyDown(int keyCode) const;
@@ -27,7 +52,8 @@ public:
 
 private:
     void EnsureSignals() const;
-    void PushInputObject(lua_State* L, const char* inputType, const char* keyName, Vector2 mousePos);
+    void DispatchInput();
+    void PushInputObject(lua_State* L, const InputEvent& e);
     void ApplyMouseBehavior();
 
     std::shared_ptr<RTScriptSignal> InputBegan;
@@ -35,6 +61,11 @@ private:
     std::shared_ptr<RTScriptSignal> InputChanged;
     std::shared_ptr<RTScriptSignal> MouseMoved;
 
+    std::vector<InputEvent> inputQueue;
+    std::vector<InputEvent> dispatching;
+    // pooled InputObjects by (UserInputType, KeyCode) name literal -> registry ref
+    std::map<std::pair<const char*, const char*>, int> inputObjects;
+
     float lastMouseX = 0;
     float lastMouseY = 0;
     
@@ -24,6 +24,7 @@ uniform float normalBiasWS2;
 out vec3 vN;
 out vec3 vWPos;
 out vec2 vTexCoord;
+out vec4 vColor;
 out vec4 vLS0;
 out vec4 vLS1;
 out vec4 vLS2;
@@ -34,6 +35,7 @@ void main(){
     vec4 worldPos = matModel * vec4(vertexPosition,1.0);
     vWPos = worldPos.xyz;
     vTexCoord = vertexTexCoord;
+    vColor = vec4(1.0);
 
     // apply normal-space small offset per-cascade to avoid contact gaps
     vec3 Nw = normalize(vN);
@@ -56,8 +58,9 @@ inline const char* LIT_VS_INST = R"(
 in vec3 vertexPosition;
 in vec3 vertexNormal;
 
-// Per-instance model matrix provided as vertex attribute
+// Per-instance model matrix and color provided as vertex attributes
 in mat4 instanceTransform;
+in vec4 instanceColor;
 
 uniform mat4 mvp;
 uniform mat4 lightVP0;
@@ -70,6 +73,7 @@ uniform float normalBiasWS2;
 
 out vec3 vN;
 out vec3 vWPos;
+out vec4 vColor;
 out vec4 vLS0;
 out vec4 vLS1;
 out vec4 vLS2;
@@ -80,6 +84,7 @@ void main(){
 
     vec4 worldPos = instanceTransform * vec4(vertexPosition,1.0);
     vWPos = worldPos.xyz;
+    vColor = instanceColor;
 
     vec3 Nw = normalize(vN);
     vec4 worldPos0 = worldPos + vec4(Nw * normalBiasWS0, 0.0);
@@ -102,6 +107,7 @@ inline const char* LIT_FS = R"(
 in vec3 vN;
 in vec3 vWPos;
 in vec2 vTexCoord;
+in vec4 vColor;
 in vec4 vLS0;
 in vec4 vLS1;
 in vec4 vLS2;
@@ -218,7 +224,8 @@ void main(){
 
     // Texture
     vec4 texColor = texture(texture0,vTexCoord);
-    vec3 base = pow((texColor * colDiffuse).rgb, vec3(2.2));
+    vec4 tint = colDiffuse * vColor;
+    vec3 base = pow((texColor * tint).rgb, vec3(2.2));
 
     // Lighting
     float sunTerm = sunStrength * ndl * shadow;
@@ -229,7 +236,7 @@ void main(){
     
     // Note: exposure/tonemapping is now done in the final composite shader
     // We output linear, high-dynamic-range color here.
-    FragColor = vec4(color, colDiffuse.a);
+    FragColor = vec4(color, tint.a);
 
     // Output world-space normal to the second render target
     NormalColor = vec4(N * 0.5 + 0.5, 1.0); // Encode to [0,1] range
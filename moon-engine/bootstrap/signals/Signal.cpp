@@ -1,11 +1,19 @@
 #include "Signal.h"
 
+#include <algorithm>
+#include <atomic>
+
+// Shared by every signal (and every Actor VM), so an id names one connection anywhere
+static std::atomic<size_t> g_nextConnectionId{1};
+
 RTScriptSignal::RTScriptSignal(LuaScheduler* s) : sched(s) {
     Lm = s ? s->GetMainState() : nullptr;
-    listeners.reserve(5120);
-    activeIdx.reserve(5120);
-    tmpActive.reserve(5120);
-    id2idx.reserve(5120);
+}
+
+void RTScriptSignal::AttachScheduler(LuaScheduler* s) {
+    if (sched || !s) return;
+    sched = s;
+    Lm = s->GetMainState();
 }
 
 RTScriptSignal::~RTScriptSignal() {
@@ -15,74 +23,92 @@ RTScriptSignal::~RTScriptSignal() {
 size_t RTScriptSignal::Connect(lua_State* L, bool once, bool parallel){
     if (closed || !Lm) return 0;
     luaL_checktype(L, 1, LUA_TFUNCTION);
+    // listeners live in the VM that owns this signal; Actor VMs can't hand functions across
+    if (lua_mainthread(L) != Lm) {
+        luaL_error(L, "Signals can only be connected from the main VM, not from inside an Actor");
+        return 0;
+    }
 
-    // move callback to main, take a registry ref (Luau API)
-    lua_pushvalue(L, 1);
-    lua_xmove(L, Lm, 1);
-    int ref = lua_ref(Lm, -1); // pops the value
+    // the registry is shared by every thread of the VM; lua_ref leaves the value in place
+    int ref = lua_ref(L, 1);
 
     Listener li;
-    li.id = nextId++;
+    li.id = g_nextConnectionId++;
     li.funcRef = ref;
     li.once = once;
     li.parallel = parallel;
     li.connected = true;
+    li.memcat = sched ? sched->MemCategoryOf(L) : 0;
 
-    if (!li.parallel) {
-        // Prepare a reusable coroutine for sequential callbacks
-        lua_newthread(Lm);
-        li.co = lua_tothread(Lm, -1);
-        luaL_sandboxthread(li.co);
-        li.threadRef = lua_ref(Lm, -1); // pops that shit thread
-    }
-
-    const size_t idx = listeners.size();
     listeners.push_back(li);
-    id2idx[li.id] = idx;
+    // filed under its script, which disconnects it when it stops
+    if (sched) sched->TrackConnection(li.memcat, weak_from_this(), li.id);
+    return li.id;
+}
 
-    activeIdx.push_back(idx);
-    listeners[idx].activePos = activeIdx.size() - 1;
+size_t RTScriptSignal::addNative(NativeListener n) {
+    if (closed) return 0;
+    n.id = g_nextConnectionId++;
+    natives.push_back(std::move(n));
+    return natives.back().id;
+}
 
-    return li.id;
+RTScriptSignal::Listener* RTScriptSignal::find(size_t id) {
+    auto it = std::lower_bound(listeners.begin(), listeners.end(), id,
+                               [](const Listener& l, size_t v) { return l.id < v; });
+    return (it != listeners.end() && it->id == id) ? &*it : nullptr;
 }
 
 bool RTScriptSignal::IsConnected(size_t id) const {
-    auto it = id2idx.find(id);
-    if (it == id2idx.end()) return false;
-    size_t idx = it->second;
-    return idx < listeners.size() && listeners[idx].connected;
+    if (const Listener* li = const_cast<RTScriptSignal*>(this)->find(id)) return li->connected;
+    for (const auto& n : natives) if (n.id == id) return n.connected;
+    return false;
 }
 
 void RTScriptSignal::Disconnect(size_t id){
-    auto it = id2idx.find(id);
-    if (it == id2idx.end()) return;
+    Listener* li = find(id);
+    if (!li) {
+        for (auto& n : natives) {
+            if (n.id != id || !n.connected) continue;
+            n.connected = false;
+            ++deadNatives;
+            compactIfSparse();
+            return;
+        }
+        return;
+    }
+    if (!li->connected) return;
 
-    const size_t idx = it->second;
-    Listener& li = listeners[idx];
+    li->connected = false;
+    if (Lm && li->funcRef != LUA_NOREF) {
+        lua_unref(Lm, li->funcRef);
+        li->funcRef = LUA_NOREF;
+    }
+    ++deadCount;
+    compactIfSparse();
+}
 
-    if (li.connected) {
-        li.connected = false;
-        if (Lm && li.funcRef != LUA_NOREF) {
-            lua_unref(Lm, li.funcRef);
-            li.funcRef = LUA_NOREF;
-        }
-        if (Lm && li.threadRef != LUA_NOREF) {
-            lua_unref(Lm, li.threadRef);
-            li.threadRef = LUA_NOREF;
-            li.co = nullptr;
-        }
-        // O(1) remove from active list
-        const size_t pos = li.activePos;
-        if (pos != Listener::npos && pos < activeIdx.size()) {
-            const size_t lastIdx = activeIdx.back();
-            activeIdx[pos] = lastIdx;
-            listeners[lastIdx].activePos = pos;
-            activeIdx.pop_back();
-            li.activePos = Listener::npos;
-        }
+// Drops disconnected slots once they are half the list; order (and so id order) is kept
+void RTScriptSignal::compactIfSparse() {
+    if (fireDepth > 0) return;
+
+    if (deadNatives > 0) {
+        // the callable may own captures, so drop it as soon as nothing is calling it
+        natives.erase(std::remove_if(natives.begin(), natives.end(),
+                                     [](const NativeListener& n) { return !n.connected; }),
+                      natives.end());
+        deadNatives = 0;
     }
 
-    id2idx.erase(it);
+    if (deadCount == 0) return;
+    if (deadCount < listeners.size() && (deadCount < 8 || deadCount * 2 < listeners.size())) return;
+
+    listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
+                                   [](const Listener& l) { return !l.connected; }),
+                    listeners.end());
+    deadCount = 0;
+    // a signal that once had thousands of listeners gives the memory back
+    if (listeners.capacity() > 4 * listeners.size() + 16) listeners.shrink_to_fit();
 }
 
 int RTScriptSignal::Wait(lua_State* L){
@@ -111,12 +137,17 @@ int RTScriptSignal::Wait(lua_State* L){
         return 0;
     }
 
+    if (lua_mainthread(L) != Lm) {
+        luaL_error(L, "Signals can only be waited on from the main VM, not from inside an Actor");
+        return 0;
+    }
+
     if (auto* self = static_cast<BaseScript*>(lua_getthreaddata(L))) {
         sched->SetWaitEvent(self);
-        waiters.push_back(Waiter{Waiter::Kind::Script, self, nullptr});
+        waiters.push_back(Waiter{Waiter::Kind::Script, self, nullptr, sched->ScriptEpoch(self)});
     } else {
         sched->SetTaskWaitEvent(L);
-        waiters.push_back(Waiter{Waiter::Kind::Task, nullptr, L});
+        waiters.push_back(Waiter{Waiter::Kind::Task, nullptr, L, sched->TaskEpoch(L)});
     }
     return lua_yield(L, 0);
 }
@@ -128,16 +159,19 @@ void RTScriptSignal::wakeWaitersWithArgsOnNextFrame(lua_State* src, int firstArg
     waiters.clear();
 
     for (auto& w : ws){
+        // cancelled, stopped or rescheduled since it started waiting
+        const bool current = (w.kind == Waiter::Kind::Script)
+                           ? sched->IsScriptCurrent(w.script, w.epoch)
+                           : sched->IsTaskCurrent(w.co, w.epoch);
+        if (!current) continue;
+
         lua_State* co = (w.kind == Waiter::Kind::Script)
                       ? sched->GetScriptThread(w.script)
                       : w.co;
         if (!co) continue;
         if (!lua_checkstack(co, argc)) continue;
 
-        for (int i = 0; i < argc; ++i) {
-            lua_pushvalue(src, firstArgIdx + i);
-            lua_xmove(src, co, 1);
-        }
+        for (int i = 0; i < argc; ++i) lua_xpush(src, co, firstArgIdx + i);
 
         if (w.kind == Waiter::Kind::Script) {
             sched->ResumeScriptNextFrame(w.script, argc);
@@ -147,47 +181,69 @@ void RTScriptSignal::wakeWaitersWithArgsOnNextFrame(lua_State* src, int firstArg
     }
 }
 
+// Each listener runs on its own pooled thread as a task, so it may yield (wait(), :Wait(),
+// a nested event); one that finishes hands the thread to the next listener, one that
+// yields keeps it and the scheduler takes it from there. The arguments stay where the
+// firing code pushed them and are copied straight onto each listener's thread.
 void RTScriptSignal::callListenersDeferred(lua_State* src, int firstArgIdx, int argc){
     if (!sched || !Lm) return;
 
+    if (listeners.size() == deadCount) return;
+
     // additions won't run this time..
-    tmpActive.assign(activeIdx.begin(), activeIdx.end());
+    const size_t end = listeners.size();
+    ++fireDepth;
 
-    for (size_t idx : tmpActive){
-        if (idx >= listeners.size()) continue;
-        Listener& l = listeners[idx];
+    LuaScheduler::PooledThread t;
+    for (size_t i = 0; i < end && i < listeners.size(); ++i){
+        // by value: a callback that connects may reallocate 'listeners'
+        const Listener l = listeners[i];
         if (!l.connected || l.funcRef == LUA_NOREF) continue;
 
-        // Call the function directly on the main thread instead of using coroutines?
-        lua_getref(Lm, l.funcRef);
-        
-        // Push arguments
-        for (int i = 0; i < argc; ++i) {
-            lua_pushvalue(src, firstArgIdx + i);
-            lua_xmove(src, Lm, 1);
-        }
-        
-        // Call the function directly
-        const int result = lua_pcall(Lm, argc, 0, 0);
-        if (result != LUA_OK) {
-            const char* error = lua_tostring(Lm, -1);
-            printf("Lua callback error: %s\n", error); // FUCK OFF
-            lua_pop(Lm, 1);
-        }
+        // Allocations made by the callback are charged to the script that connected it.
+        if (!t.co) t = sched->AcquireThread(l.memcat);
+        else lua_setmemcat(t.co, l.memcat);
+        if (!t.co) break;
+        if (!lua_checkstack(t.co, argc + 1)) continue;
 
-        if (l.once) {
-            // safe with tmpActive
-            Disconnect(l.id);
-        }
+        lua_getref(t.co, l.funcRef);
+        // before running, so a Once listener that yields isn't fired again meanwhile
+        if (l.once) Disconnect(l.id);
+        for (int a = 0; a < argc; ++a) lua_xpush(src, t.co, firstArgIdx + a);
+
+        if (sched->RunTaskNow(t, argc, l.memcat)) lua_resetthread(t.co);
+        else t = LuaScheduler::PooledThread{}; // parked; next listener takes a fresh thread
     }
 
-    tmpActive.clear();
+    --fireDepth;
+    if (t.co) sched->ReleaseThread(t);
+    compactIfSparse();
+}
+
+void RTScriptSignal::fireNatives(const void* type, const void* packed) {
+    static const void* const untyped = ArgsTag<>();
+
+    const size_t end = natives.size();
+    ++fireDepth;
+    for (size_t i = 0; i < end && i < natives.size(); ++i) {
+        auto& n = natives[i];
+        if (!n.connected) continue;
+        if (n.type == type) n.fn(packed);
+        else if (n.type == untyped) n.fn(nullptr);
+    }
+    --fireDepth;
+    compactIfSparse();
+}
+
+void RTScriptSignal::fireLua(lua_State* src, int firstArgIdx, int argc) {
+    callListenersDeferred(src, firstArgIdx, argc);
+    wakeWaitersWithArgsOnNextFrame(src, firstArgIdx, argc);
 }
 
 void RTScriptSignal::Fire(lua_State* L, int firstArgIdx, int argc){
     if (closed) return;
-    callListenersDeferred(L, firstArgIdx, argc);
-    wakeWaitersWithArgsOnNextFrame(L, firstArgIdx, argc);
+    if (!natives.empty()) fireNatives(ArgsTag<>(), nullptr);
+    fireLua(L, firstArgIdx, argc);
 }
 
 void RTScriptSignal::Close(){
@@ -198,18 +254,14 @@ void RTScriptSignal::Close(){
         if (Lm && l.funcRef != LUA_NOREF) {
             lua_unref(Lm, l.funcRef);
         }
-        if (Lm && l.threadRef != LUA_NOREF) {
-            lua_unref(Lm, l.threadRef);
-        }
         l.connected = false;
         l.funcRef = LUA_NOREF;
-        l.threadRef = LUA_NOREF;
-        l.co = nullptr;
-        l.activePos = Listener::npos;
     }
 
+    // a Fire in progress stops at the now-empty lists
     listeners.clear();
-    id2idx.clear();
-    activeIdx.clear();
-    tmpActive.clear();
+    listeners.shrink_to_fit();
+    deadCount = 0;
+    if (fireDepth == 0) natives.clear();
+    else for (auto& n : natives) if (n.connected) { n.connected = false; ++deadNatives; }
 }
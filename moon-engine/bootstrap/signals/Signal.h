@@ -1,12 +1,34 @@
 #pragma once
-#include <vector>
-#include <unordered_map>
+#include <deque>
+#include <functional>
 #include <memory>
-#include <limits>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 #include "lua.h"
 #include "lualib.h"
 
 #include "bootstrap/LuaScheduler.h"
+#include "bootstrap/ScriptingAPI.h"
+
+// How Emit hands a C++ value to Lua listeners
+inline void PushSignalArg(lua_State* L, bool v)               { lua_pushboolean(L, v); }
+inline void PushSignalArg(lua_State* L, int v)                { lua_pushinteger(L, v); }
+inline void PushSignalArg(lua_State* L, float v)              { lua_pushnumber(L, v); }
+inline void PushSignalArg(lua_State* L, double v)             { lua_pushnumber(L, v); }
+inline void PushSignalArg(lua_State* L, const char* v)        { lua_pushstring(L, v); }
+inline void PushSignalArg(lua_State* L, const std::string& v) { lua_pushlstring(L, v.data(), v.size()); }
+inline void PushSignalArg(lua_State* L, const std::shared_ptr<Instance>& v) { Lua_PushInstance(L, v); }
+
+// What native listeners and Emit agree on for one argument: numbers travel as double
+// and C strings (literals included) as const char*, anything else by const reference
+template<class T, class D = std::decay_t<T>>
+using NativeSignalArg =
+    std::conditional_t<std::is_same_v<D, bool>, bool,
+    std::conditional_t<std::is_arithmetic_v<D>, double,
+    std::conditional_t<std::is_same_v<D, char*> || std::is_same_v<D, const char*>, const char*,
+                       const D&>>>;
 
 struct RTScriptSignal : std::enable_shared_from_this<RTScriptSignal> {
     struct Listener {
@@ -15,21 +37,23 @@ struct RTScriptSignal : std::enable_shared_from_this<RTScriptSignal> {
         bool   once{false};
         bool   parallel{false};
         bool   connected{true};
-        size_t activePos{npos};
-        // Reusable coroutine for non-parallel listeners
-        lua_State* co{nullptr};
-        int threadRef{LUA_NOREF};  // registry ref that owns the thread
-        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+        int    memcat{0};          // memory category of the connecting script
     };
     struct Waiter {
         enum class Kind { Script, Task };
         Kind        kind{Kind::Task};
         BaseScript* script{nullptr};
         lua_State*  co{nullptr};
+        uint32_t    epoch{0};       // scheduler epoch when it started waiting
     };
 
+    const char* name = "Signal";   // for diagnostics, e.g. "RunService.Heartbeat"; a literal
+
+    // 's' may be null for a signal only engine code listens to; Lua can't connect until
+    // AttachScheduler gives it one.
     explicit RTScriptSignal(LuaScheduler* s);
     ~RTScriptSignal();
+    void   AttachScheduler(LuaScheduler* s);
 
     // Lua bindings:
     size_t Connect(lua_State* L, bool once=false, bool parallel=false);
@@ -37,22 +61,81 @@ struct RTScriptSignal : std::enable_shared_from_this<RTScriptSignal> {
     void   Fire(lua_State* L, int firstArgIdx, int argc);
     void   Close();                                 // disconnect all, do not resume waiters
 
-    // Connection handles:
+    // Native listeners: plain C++ callables, no registry ref and no thread. They run
+    // before the Lua listeners and are typed by the arguments they take, e.g.
+    //   sig->ConnectNative<std::shared_ptr<Instance>>([](const std::shared_ptr<Instance>& c){ ... });
+    // Emit with matching argument types reaches them, compared after NativeSignalArg, so
+    // Emit(1.0f) reaches a double listener and Emit("lit") a const char* one. A listener
+    // with no arguments runs on every Emit and Fire. Fire (arguments already on a Lua
+    // stack) reaches only those.
+    template<class... Args, class F>
+    size_t ConnectNative(F&& fn) {
+        NativeListener n;
+        n.type = ArgsTag<NativeSignalArg<Args>...>();
+        n.fn = [f = std::forward<F>(fn)](const void* packed) {
+            if constexpr (sizeof...(Args) == 0) { (void)packed; f(); }
+            else std::apply(f, *static_cast<const std::tuple<NativeSignalArg<Args>...>*>(packed));
+        };
+        return addNative(std::move(n));
+    }
+
+    // Fires from C++: native listeners get the values as they are, Lua listeners and
+    // waiters get them pushed onto the main thread, and only when there are any.
+    template<class... Args>
+    void Emit(const Args&... args) {
+        if (closed) return;
+        if (!natives.empty()) {
+            const std::tuple<NativeSignalArg<Args>...> packed(args...);
+            fireNatives(ArgsTag<NativeSignalArg<Args>...>(), &packed);
+        }
+        if (!HasLuaListeners()) return;
+
+        const int top = lua_gettop(Lm);
+        if (!lua_checkstack(Lm, int(sizeof...(Args)))) return;
+        (PushSignalArg(Lm, args), ...);
+        fireLua(Lm, top + 1, int(sizeof...(Args)));
+        lua_settop(Lm, top);
+    }
+
+    // Connection handles (ids are unique across all signals):
     void   Disconnect(size_t id);
     bool   IsConnected(size_t id) const;
     bool   IsClosed() const { return closed; }
+    bool   HasLuaListeners() const { return Lm && (listeners.size() > deadCount || !waiters.empty()); }
 
 private:
+    struct NativeListener {
+        size_t      id{0};
+        const void* type{nullptr};                 // ArgsTag of the arguments it takes
+        std::function<void(const void*)> fn;       // gets a tuple<NativeSignalArg<Args>...>*
+        bool        connected{true};
+    };
+
+    // One address per argument list; not const, so identical-data folding can't merge them
+    template<class... Args>
+    static const void* ArgsTag() { static char tag; return &tag; }
+
     LuaScheduler* sched{};
     lua_State*    Lm{};
     bool          closed{false};
 
-    size_t nextId{1};
-    std::vector<Listener> listeners;                 // stable indices
-    std::unordered_map<size_t,size_t> id2idx;        // id -> listeners[idx]
-    std::vector<size_t> activeIdx;                   // connected listener indices
-    std::vector<size_t> tmpActive;                   // per-fire snapshot
+    // In connection order, so ids are ascending and found by binary search. Most signals
+    // (a Tween's Completed, unused RunService events) never get a listener and own no
+    // heap at all. Disconnected slots stay in place until they make up half the list,
+    // and are never moved while a Fire is walking it.
+    std::vector<Listener> listeners;
+    size_t deadCount{0};
+    int    fireDepth{0};
     std::vector<Waiter> waiters;
+    // a deque so a callback that connects doesn't move the one that is running
+    std::deque<NativeListener> natives;
+    size_t deadNatives{0};
+
+    Listener* find(size_t id);
+    void      compactIfSparse();
+    size_t    addNative(NativeListener n);
+    void      fireNatives(const void* type, const void* packed);
+    void      fireLua(lua_State* src, int firstArgIdx, int argc);
 
     void wakeWaitersWithArgsOnNextFrame(lua_State* src, int firstArgIdx, int argc);
     void callListenersDeferred(lua_State* src, int firstArgIdx, int argc);
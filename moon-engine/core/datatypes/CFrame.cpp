@@ -2,6 +2,7 @@
 #include <cmath>
 #include <cstring>
 #include <algorithm>
+#include <utility>
 
 using namespace lb;
 
@@ -14,51 +15,158 @@ using namespace lb;
 static inline float clampf(float x, float a, float b){ return x < a ? a : (x > b ? b : x); }
 static inline float rsqrt(float x){ return 1.0f/std::sqrt(x); }
 
-// ---------- C++ Implementation ----------
-CFrame::CFrame(){ R[0]=R[4]=R[8]=1; R[1]=R[2]=R[3]=R[5]=R[6]=R[7]=0; p={0,0,0}; }
-CFrame::CFrame(const Vector3Game& t): CFrame(){ p=t; }
-CFrame::CFrame(float a,float b,float c,float d,float e,float f,float g,float h,float i,const Vector3Game& t){
-    R[0]=a;R[1]=b;R[2]=c; R[3]=d;R[4]=e;R[5]=f; R[6]=g;R[7]=h;R[8]=i; p=t;
-}
+// ---------- SIMD ----------
+// Four-lane helpers the transform math is written against. Every column of a
+// CFrame is one register; lane 3 carries padding and is never read back.
+// Operations are kept in the same order as the scalar formulas, with no fused
+// multiply-add, so SSE results match the scalar fallback bit for bit.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+namespace {
+using v4 = __m128;
+inline v4   load(const float* f)     { return _mm_loadu_ps(f); }
+inline void store(float* f, v4 v)    { _mm_storeu_ps(f, v); }
+inline v4   splat(float s)           { return _mm_set1_ps(s); }
+inline v4   add(v4 a, v4 b)          { return _mm_add_ps(a, b); }
+inline v4   sub(v4 a, v4 b)          { return _mm_sub_ps(a, b); }
+inline v4   mul(v4 a, v4 b)          { return _mm_mul_ps(a, b); }
+inline v4   neg(v4 a)                { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+inline void transpose3(v4& a, v4& b, v4& c) {
+    v4 d = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(a, b, c, d);
+}
+} // namespace
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+namespace {
+using v4 = float32x4_t;
+inline v4   load(const float* f)     { return vld1q_f32(f); }
+inline void store(float* f, v4 v)    { vst1q_f32(f, v); }
+inline v4   splat(float s)           { return vdupq_n_f32(s); }
+inline v4   add(v4 a, v4 b)          { return vaddq_f32(a, b); }
+inline v4   sub(v4 a, v4 b)          { return vsubq_f32(a, b); }
+inline v4   mul(v4 a, v4 b)          { return vmulq_f32(a, b); }
+inline v4   neg(v4 a)                { return vnegq_f32(a); }
+inline void transpose3(v4& a, v4& b, v4& c) {
+    const float32x4x2_t ab = vtrnq_f32(a, b);             // a0 b0 a2 b2 | a1 b1 a3 b3
+    const float32x4x2_t cz = vtrnq_f32(c, vdupq_n_f32(0)); // c0 0  c2 0  | c1 0  c3 0
+    a = vcombine_f32(vget_low_f32(ab.val[0]),  vget_low_f32(cz.val[0]));
+    b = vcombine_f32(vget_low_f32(ab.val[1]),  vget_low_f32(cz.val[1]));
+    c = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cz.val[0]));
+}
+} // namespace
+#else
+namespace {
+struct v4 { float f[4]; };
+inline v4   load(const float* f)     { return {{f[0], f[1], f[2], f[3]}}; }
+inline void store(float* f, v4 v)    { for (int i = 0; i < 4; ++i) f[i] = v.f[i]; }
+inline v4   splat(float s)           { return {{s, s, s, s}}; }
+inline v4   add(v4 a, v4 b)          { return {{a.f[0]+b.f[0], a.f[1]+b.f[1], a.f[2]+b.f[2], a.f[3]+b.f[3]}}; }
+inline v4   sub(v4 a, v4 b)          { return {{a.f[0]-b.f[0], a.f[1]-b.f[1], a.f[2]-b.f[2], a.f[3]-b.f[3]}}; }
+inline v4   mul(v4 a, v4 b)          { return {{a.f[0]*b.f[0], a.f[1]*b.f[1], a.f[2]*b.f[2], a.f[3]*b.f[3]}}; }
+inline v4   neg(v4 a)                { return {{-a.f[0], -a.f[1], -a.f[2], -a.f[3]}}; }
+inline void transpose3(v4& a, v4& b, v4& c) {
+    std::swap(a.f[1], b.f[0]); std::swap(a.f[2], c.f[0]); std::swap(b.f[2], c.f[1]);
+}
+} // namespace
+#endif
 
-// Copy constructor
-CFrame::CFrame(const CFrame& other) {
-    for (int i = 0; i < 9; ++i) {
-        R[i] = other.R[i];
+namespace {
+// c0*x + c1*y + c2*z, summed left to right
+inline v4 combine(v4 c0, v4 c1, v4 c2, float x, float y, float z) {
+    return add(add(mul(c0, splat(x)), mul(c1, splat(y))), mul(c2, splat(z)));
+}
+inline Vector3Game toVec(v4 v) {
+    float f[4]; store(f, v);
+    return { f[0], f[1], f[2] };
+}
+} // namespace
+
+// ---------- Quaternions (rotation interpolation) ----------
+namespace {
+struct Quat { float x, y, z, w; };
+
+Quat quatFromCFrame(const CFrame& cf) {
+    // Shepperd's method: pivot on the largest diagonal term for stability
+    const float m00 = cf.r(0,0), m11 = cf.r(1,1), m22 = cf.r(2,2);
+    const float trace = m00 + m11 + m22;
+    Quat q;
+    if (trace > 0.0f) {
+        const float s = 0.5f * rsqrt(trace + 1.0f);     // 1 / (4w)
+        q.w = 0.25f / s;
+        q.x = (cf.r(2,1) - cf.r(1,2)) * s;
+        q.y = (cf.r(0,2) - cf.r(2,0)) * s;
+        q.z = (cf.r(1,0) - cf.r(0,1)) * s;
+    } else if (m00 > m11 && m00 > m22) {
+        const float s = 0.5f * rsqrt(1.0f + m00 - m11 - m22);
+        q.w = (cf.r(2,1) - cf.r(1,2)) * s;
+        q.x = 0.25f / s;
+        q.y = (cf.r(0,1) + cf.r(1,0)) * s;
+        q.z = (cf.r(0,2) + cf.r(2,0)) * s;
+    } else if (m11 > m22) {
+        const float s = 0.5f * rsqrt(1.0f + m11 - m00 - m22);
+        q.w = (cf.r(0,2) - cf.r(2,0)) * s;
+        q.x = (cf.r(0,1) + cf.r(1,0)) * s;
+        q.y = 0.25f / s;
+        q.z = (cf.r(1,2) + cf.r(2,1)) * s;
+    } else {
+        const float s = 0.5f * rsqrt(1.0f + m22 - m00 - m11);
+        q.w = (cf.r(1,0) - cf.r(0,1)) * s;
+        q.x = (cf.r(0,2) + cf.r(2,0)) * s;
+        q.y = (cf.r(1,2) + cf.r(2,1)) * s;
+        q.z = 0.25f / s;
     }
-    p = other.p;
+    return q; // unit for an orthonormal rotation; slerp renormalizes its result
 }
 
-// Assignment operator
-CFrame& CFrame::operator=(const CFrame& other) {
-    if (this != &other) {
-        for (int i = 0; i < 9; ++i) {
-            R[i] = other.R[i];
-        }
-        p = other.p;
+CFrame cframeFromQuat(const Quat& q, const Vector3Game& pos) {
+    const float xx = q.x*q.x, yy = q.y*q.y, zz = q.z*q.z;
+    const float xy = q.x*q.y, xz = q.x*q.z, yz = q.y*q.z;
+    const float wx = q.w*q.x, wy = q.w*q.y, wz = q.w*q.z;
+    return CFrame(1.0f - 2.0f*(yy + zz), 2.0f*(xy - wz),        2.0f*(xz + wy),
+                  2.0f*(xy + wz),        1.0f - 2.0f*(xx + zz), 2.0f*(yz - wx),
+                  2.0f*(xz - wy),        2.0f*(yz + wx),        1.0f - 2.0f*(xx + yy),
+                  pos);
+}
+
+Quat slerp(const Quat& a, Quat b, float t) {
+    float d = a.x*b.x + a.y*b.y + a.z*b.z + a.w*b.w;
+    if (d < 0.0f) { b = { -b.x, -b.y, -b.z, -b.w }; d = -d; } // shortest arc
+
+    float wa, wb;
+    if (d > 0.9995f) {
+        // nearly parallel: normalized lerp avoids dividing by sin(~0)
+        wa = 1.0f - t; wb = t;
+    } else {
+        const float theta = std::acos(d);
+        const float invSin = rsqrt(1.0f - d*d);             // 1 / sin(theta)
+        wa = std::sin((1.0f - t) * theta) * invSin;
+        wb = std::sin(t * theta) * invSin;
     }
-    return *this;
+    Quat q{ wa*a.x + wb*b.x, wa*a.y + wb*b.y, wa*a.z + wb*b.z, wa*a.w + wb*b.w };
+    const float n = rsqrt(q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w);
+    return { q.x*n, q.y*n, q.z*n, q.w*n };
 }
+} // namespace
+
+// ---------- C++ Implementation ----------
+CFrame::CFrame()
+    : col{ {1,0,0,0}, {0,1,0,0}, {0,0,1,0} }, p{0,0,0}, pad(0) {}
+CFrame::CFrame(const Vector3Game& t): CFrame(){ p=t; }
+CFrame::CFrame(float a,float b,float c,float d,float e,float f,float g,float h,float i,const Vector3Game& t)
+    : col{ {a,d,g,0}, {b,e,h,0}, {c,f,i,0} }, p(t), pad(0) {}
 
 CFrame CFrame::operator*(const CFrame& B) const {
+    const v4 a0 = load(col[0]), a1 = load(col[1]), a2 = load(col[2]);
     CFrame C;
-    C.R[0]=R[0]*B.R[0]+R[1]*B.R[3]+R[2]*B.R[6];
-    C.R[1]=R[0]*B.R[1]+R[1]*B.R[4]+R[2]*B.R[7];
-    C.R[2]=R[0]*B.R[2]+R[1]*B.R[5]+R[2]*B.R[8];
-    C.R[3]=R[3]*B.R[0]+R[4]*B.R[3]+R[5]*B.R[6];
-    C.R[4]=R[3]*B.R[1]+R[4]*B.R[4]+R[5]*B.R[7];
-    C.R[5]=R[3]*B.R[2]+R[4]*B.R[5]+R[5]*B.R[8];
-    C.R[6]=R[6]*B.R[0]+R[7]*B.R[3]+R[8]*B.R[6];
-    C.R[7]=R[6]*B.R[1]+R[7]*B.R[4]+R[8]*B.R[7];
-    C.R[8]=R[6]*B.R[2]+R[7]*B.R[5]+R[8]*B.R[8];
-    C.p = (*this) * B.p;
+    for (int j = 0; j < 3; ++j)
+        store(C.col[j], combine(a0, a1, a2, B.col[j][0], B.col[j][1], B.col[j][2]));
+    store(&C.p.x, add(combine(a0, a1, a2, B.p.x, B.p.y, B.p.z), load(&p.x)));
     return C;
 }
 
 Vector3Game CFrame::operator*(const Vector3Game& v) const {
-    return { R[0]*v.x + R[1]*v.y + R[2]*v.z + p.x,
-             R[3]*v.x + R[4]*v.y + R[5]*v.z + p.y,
-             R[6]*v.x + R[7]*v.y + R[8]*v.z + p.z };
+    return pointToWorldSpace(v);
 }
 
 CFrame CFrame::operator+(const Vector3Game& v) const {
@@ -68,33 +176,24 @@ CFrame CFrame::operator+(const Vector3Game& v) const {
 }
 
 CFrame CFrame::inverse() const {
+    // rotation inverse = transpose; translation = -R^T * p
+    v4 t0 = load(col[0]), t1 = load(col[1]), t2 = load(col[2]);
+    transpose3(t0, t1, t2);
     CFrame inv;
-    // rotation inverse = transpose
-    inv.R[0]=R[0]; inv.R[1]=R[3]; inv.R[2]=R[6];
-    inv.R[3]=R[1]; inv.R[4]=R[4]; inv.R[5]=R[7];
-    inv.R[6]=R[2]; inv.R[7]=R[5]; inv.R[8]=R[8];
-    // translate by -R^T * p
-    inv.p = { -(inv.R[0]*p.x + inv.R[1]*p.y + inv.R[2]*p.z),
-              -(inv.R[3]*p.x + inv.R[4]*p.y + inv.R[5]*p.z),
-              -(inv.R[6]*p.x + inv.R[7]*p.y + inv.R[8]*p.z) };
+    store(inv.col[0], t0);
+    store(inv.col[1], t1);
+    store(inv.col[2], t2);
+    store(&inv.p.x, neg(combine(t0, t1, t2, p.x, p.y, p.z)));
+    inv.pad = 0.0f;
     return inv;
 }
 
 CFrame CFrame::lerp(const CFrame& goal, float alpha) const {
-    Vector3Game new_p = p.lerp(goal.p, alpha);
-
-    // Simple basis lerp + Gram-Schmidt
-    Vector3Game rV = rightVector().lerp(goal.rightVector(), alpha).normalized();
-    Vector3Game uV = upVector().lerp(goal.upVector(), alpha);
-    Vector3Game lV = rV.cross(uV).normalized();
-    uV = lV.cross(rV).normalized();
-
-    CFrame result;
-    result.p = new_p;
-    result.R[0]=rV.x; result.R[1]=uV.x; result.R[2]=lV.x;
-    result.R[3]=rV.y; result.R[4]=uV.y; result.R[5]=lV.y;
-    result.R[6]=rV.z; result.R[7]=uV.z; result.R[8]=lV.z;
-    return result;
+    // Exact endpoints only: alpha outside [0, 1] extrapolates along the same arc
+    if (alpha == 0.0f) return *this;
+    if (alpha == 1.0f) return goal;
+    return cframeFromQuat(slerp(quatFromCFrame(*this), quatFromCFrame(goal), alpha),
+                          p.lerp(goal.p, alpha));
 }
 
 CFrame CFrame::Angles(float rx, float ry, float rz) {
@@ -105,13 +204,11 @@ CFrame CFrame::fromEulerAnglesXYZ(float rx, float ry, float rz) {
     float cx = std::cos(rx), sx = std::sin(rx);
     float cy = std::cos(ry), sy = std::sin(ry);
     float cz = std::cos(rz), sz = std::sin(rz);
-    CFrame m;
     // matches existing engine convention
-    m.R[0] = cy*cz + sy*sx*sz; m.R[1] = cx*sz; m.R[2] = -sy*cz + cy*sx*sz;
-    m.R[3] = -cy*sz + sy*sx*cz; m.R[4] = cx*cz; m.R[5] = sy*sz + cy*sx*cz;
-    m.R[6] = sy*cx;             m.R[7] = -sx;   m.R[8] = cy*cx;
-    m.p = {0,0,0};
-    return m;
+    return CFrame( cy*cz + sy*sx*sz,  cx*sz, -sy*cz + cy*sx*sz,
+                  -cy*sz + sy*sx*cz,  cx*cz,  sy*sz + cy*sx*cz,
+                   sy*cx,            -sx,     cy*cx,
+                   Vector3Game{0,0,0});
 }
 
 CFrame CFrame::fromEulerAnglesYXZ(float ry, float rx, float rz) {
@@ -131,12 +228,10 @@ CFrame CFrame::fromAxisAngle(const Vector3Game& axisIn, float angle) {
     float c = std::cos(angle), s = std::sin(angle), t = 1.0f - c;
     float x=a.x, y=a.y, z=a.z;
 
-    CFrame m;
-    m.R[0] = t*x*x + c;     m.R[1] = t*x*y + s*z; m.R[2] = t*x*z - s*y;
-    m.R[3] = t*x*y - s*z;   m.R[4] = t*y*y + c;   m.R[5] = t*y*z + s*x;
-    m.R[6] = t*x*z + s*y;   m.R[7] = t*y*z - s*x; m.R[8] = t*z*z + c;
-    m.p = {0,0,0};
-    return m;
+    return CFrame(t*x*x + c,   t*x*y + s*z, t*x*z - s*y,
+                  t*x*y - s*z, t*y*y + c,   t*y*z + s*x,
+                  t*x*z + s*y, t*y*z - s*x, t*z*z + c,
+                  Vector3Game{0,0,0});
 }
 
 CFrame CFrame::fromOrientation(float rx, float ry, float rz) {
@@ -149,12 +244,10 @@ CFrame CFrame::fromMatrix(const Vector3Game& pos,
                           const Vector3Game& y,
                           const Vector3Game& z) {
     // Expect right=x, up=y, look=z (engine's basis)
-    CFrame m;
-    m.p = pos;
-    m.R[0]=x.x; m.R[1]=y.x; m.R[2]=z.x;
-    m.R[3]=x.y; m.R[4]=y.y; m.R[5]=z.y;
-    m.R[6]=x.z; m.R[7]=y.z; m.R[8]=z.z;
-    return m.orthonormalized();
+    return CFrame(x.x, y.x, z.x,
+                  x.y, y.y, z.y,
+                  x.z, y.z, z.z,
+                  pos).orthonormalized();
 }
 
 CFrame CFrame::lookAt(const Vector3Game& eye, const Vector3Game& target) {
@@ -164,12 +257,10 @@ CFrame CFrame::lookAt(const Vector3Game& eye, const Vector3Game& target) {
         right = Vector3Game(1, 0, 0).cross(look).normalized();
     Vector3Game up = look.cross(right);
 
-    CFrame c;
-    c.p = eye;
-    c.R[0]=right.x; c.R[1]=up.x; c.R[2]=look.x;
-    c.R[3]=right.y; c.R[4]=up.y; c.R[5]=look.y;
-    c.R[6]=right.z; c.R[7]=up.z; c.R[8]=look.z;
-    return c;
+    return CFrame(right.x, up.x, look.x,
+                  right.y, up.y, look.y,
+                  right.z, up.z, look.z,
+                  eye);
 }
 
 CFrame CFrame::orthonormalized(float eps) const {
@@ -181,92 +272,106 @@ CFrame CFrame::orthonormalized(float eps) const {
     r = r.normalized();
     l = l.normalized();
     u = l.cross(r).normalized();
-    CFrame out = *this;
-    out.R[0]=r.x; out.R[1]=u.x; out.R[2]=l.x;
-    out.R[3]=r.y; out.R[4]=u.y; out.R[5]=l.y;
-    out.R[6]=r.z; out.R[7]=u.z; out.R[8]=l.z;
+    return CFrame(r.x, u.x, l.x,
+                  r.y, u.y, l.y,
+                  r.z, u.z, l.z,
+                  p);
+}
+
+CFrame CFrame::withRotationOf(const CFrame& rot) const {
+    CFrame out = rot;
+    out.p = p;
     return out;
 }
 
+CFrame CFrame::unpack(const void* src) {
+    float f[12];
+    std::memcpy(f, src, sizeof(f));
+    return CFrame(f[3], f[4],  f[5],
+                  f[6], f[7],  f[8],
+                  f[9], f[10], f[11],
+                  Vector3Game{f[0], f[1], f[2]});
+}
+
+void CFrame::pack(void* dst) const {
+    const float f[12] = { p.x, p.y, p.z,
+                          r(0,0), r(0,1), r(0,2),
+                          r(1,0), r(1,1), r(1,2),
+                          r(2,0), r(2,1), r(2,2) };
+    std::memcpy(dst, f, sizeof(f));
+}
+
 // Space transforms
 Vector3Game CFrame::vectorToWorldSpace(const Vector3Game& v) const {
-    return { R[0]*v.x + R[1]*v.y + R[2]*v.z,
-             R[3]*v.x + R[4]*v.y + R[5]*v.z,
-             R[6]*v.x + R[7]*v.y + R[8]*v.z };
+    return toVec(combine(load(col[0]), load(col[1]), load(col[2]), v.x, v.y, v.z));
 }
 Vector3Game CFrame::vectorToObjectSpace(const Vector3Game& v) const {
     // multiply by R^T
-    return { R[0]*v.x + R[3]*v.y + R[6]*v.z,
-             R[1]*v.x + R[4]*v.y + R[7]*v.z,
-             R[2]*v.x + R[5]*v.y + R[8]*v.z };
+    v4 t0 = load(col[0]), t1 = load(col[1]), t2 = load(col[2]);
+    transpose3(t0, t1, t2);
+    return toVec(combine(t0, t1, t2, v.x, v.y, v.z));
 }
 Vector3Game CFrame::pointToWorldSpace(const Vector3Game& v) const {
-    Vector3Game w = vectorToWorldSpace(v);
-    return { w.x + p.x, w.y + p.y, w.z + p.z };
+    return toVec(add(combine(load(col[0]), load(col[1]), load(col[2]), v.x, v.y, v.z), load(&p.x)));
 }
 Vector3Game CFrame::pointToObjectSpace(const Vector3Game& v) const {
-    Vector3Game d = v - p;
-    return { R[0]*d.x + R[3]*d.y + R[6]*d.z,
-             R[1]*d.x + R[4]*d.y + R[7]*d.z,
-             R[2]*d.x + R[5]*d.y + R[8]*d.z };
+    return vectorToObjectSpace(v - p);
 }
 
 // Decompositions (radians)
 void CFrame::toEulerAnglesXYZ(float& rx, float& ry, float& rz) const {
-    float sx = -R[7];
+    float sx = -r(2,1);
     float cx = std::sqrt(std::max(0.0f, 1.0f - sx*sx));
     rx = std::atan2(sx, cx);
 
     if (cx > 1e-6f) {
-        float sy = R[6] / cx;
-        float cy = R[8] / cx;
-        float sz = R[1] / cx;
-        float cz = R[4] / cx;
+        float sy = r(2,0) / cx;
+        float cy = r(2,2) / cx;
+        float sz = r(0,1) / cx;
+        float cz = r(1,1) / cx;
         ry = std::atan2(sy, cy);
         rz = std::atan2(sz, cz);
     } else {
         // gimbal lock
-        ry = std::atan2(-R[2], R[0]);
+        ry = std::atan2(-r(0,2), r(0,0));
         rz = 0.0f;
     }
 }
 
 void CFrame::toEulerAnglesYXZ(float& ry, float& rx, float& rz) const {
     // For order Y * X * Z derived in analysis
-    float sx = R[5 - 3]; // R12 in row-major: index 5? Wait mapping: R[0..2] row0, [3..5] row1, [6..8] row2
-    // R12 = element row 1 col 2 -> index 5:
-    sx = R[5];
+    float sx = r(1,2);  // R12
     rx = std::asin(clampf(sx, -1.0f, 1.0f));
     float cx = std::cos(rx);
 
     if (std::fabs(cx) > 1e-6f) {
-        float sy = R[2] / cx;   // R02
-        float cy = R[8] / cx;   // R22
+        float sy = r(0,2) / cx;   // R02
+        float cy = r(2,2) / cx;   // R22
         ry = std::atan2(sy, cy);
 
-        float sz = -R[3] / cx;  // -R10
-        float cz =  R[4] / cx;  //  R11
+        float sz = -r(1,0) / cx;  // -R10
+        float cz =  r(1,1) / cx;  //  R11
         rz = std::atan2(sz, cz);
     } else {
         // gimbal lock: choose rz = 0, solve ry from R01,R00
         rz = 0.0f;
-        ry = std::atan2(R[1], R[0]);
+        ry = std::atan2(r(0,1), r(0,0));
     }
 }
 
 void CFrame::toAxisAngle(Vector3Game& axis, float& angle) const {
-    float trace = R[0] + R[4] + R[8];
+    float trace = r(0,0) + r(1,1) + r(2,2);
     float c = clampf((trace - 1.0f)*0.5f, -1.0f, 1.0f);
     angle = std::acos(c);
 
     if (angle < 1e-6f) { axis = {0,1,0}; angle = 0.0f; return; }
     if (std::fabs(PI - angle) < 1e-4f) {
-        float xx = std::sqrt(std::max(0.0f, (R[0] + 1.0f)*0.5f));
-        float yy = std::sqrt(std::max(0.0f, (R[4] + 1.0f)*0.5f));
-        float zz = std::sqrt(std::max(0.0f, (R[8] + 1.0f)*0.5f));
-        xx = std::copysign(xx, R[7] - R[5]);
-        yy = std::copysign(yy, R[2] - R[6]);
-        zz = std::copysign(zz, R[3] - R[1]);
+        float xx = std::sqrt(std::max(0.0f, (r(0,0) + 1.0f)*0.5f));
+        float yy = std::sqrt(std::max(0.0f, (r(1,1) + 1.0f)*0.5f));
+        float zz = std::sqrt(std::max(0.0f, (r(2,2) + 1.0f)*0.5f));
+        xx = std::copysign(xx, r(2,1) - r(1,2));
+        yy = std::copysign(yy, r(0,2) - r(2,0));
+        zz = std::copysign(zz, r(1,0) - r(0,1));
         float len = std::sqrt(xx*xx + yy*yy + zz*zz);
         if (len < 1e-6f) { axis = {0,1,0}; angle = PI; return; }
         axis = { xx/len, yy/len, zz/len };
@@ -274,7 +379,7 @@ void CFrame::toAxisAngle(Vector3Game& axis, float& angle) const {
     }
 
     float s = 2.0f*std::sin(angle);
-    axis = { (R[7]-R[5])/s, (R[2]-R[6])/s, (R[3]-R[1])/s };
+    axis = { (r(2,1)-r(1,2))/s, (r(0,2)-r(2,0))/s, (r(1,0)-r(0,1))/s };
     float ln = std::sqrt(axis.x*axis.x + axis.y*axis.y + axis.z*axis.z);
     if (ln > 1e-6f) axis = axis * (1.0f/ln);
     else axis = {0,1,0};
@@ -290,12 +395,12 @@ static int cf_new(lua_State* L){
     int n = lua_gettop(L);
     if (n == 0) { lb::push(L, CFrame{}); return 1; }
 
-    if (n == 1 && luaL_testudata(L, 1, Traits<Vector3Game>::MetaName())) {
+    if (n == 1 && lua_isvector(L, 1)) {
         const auto* v = lb::check<Vector3Game>(L, 1);
         lb::push(L, CFrame(*v)); return 1;
     }
 
-    if (n == 2 && luaL_testudata(L, 1, Traits<Vector3Game>::MetaName()) && luaL_testudata(L, 2, Traits<Vector3Game>::MetaName())) {
+    if (n == 2 && lua_isvector(L, 1) && lua_isvector(L, 2)) {
         const auto* pos = lb::check<Vector3Game>(L, 1);
         const auto* lookAt = lb::check<Vector3Game>(L, 2);
         lb::push(L, CFrame::lookAt(*pos, *lookAt)); return 1;
@@ -328,10 +433,9 @@ static int cf_add(lua_State* L) {
 
 static int cf_mul(lua_State* L){
     const auto* A = lb::check<CFrame>(L,1);
-    if (luaL_testudata(L, 2, Traits<CFrame>::MetaName())) {
-        const auto* B = lb::check<CFrame>(L,2);
+    if (const auto* B = lb::test<CFrame>(L, 2)) {
         lb::push(L, (*A) * (*B));
-    } else if (luaL_testudata(L, 2, Traits<Vector3Game>::MetaName())) {
+    } else if (lua_isvector(L, 2)) {
         const auto* B = lb::check<Vector3Game>(L,2);
         lb::push(L, (*A) * (*B));
     } else {
@@ -398,9 +502,9 @@ static int cf_components(lua_State* L){
     lua_pushnumber(L, c->p.x);
     lua_pushnumber(L, c->p.y);
     lua_pushnumber(L, c->p.z);
-    lua_pushnumber(L, c->R[0]); lua_pushnumber(L, c->R[1]); lua_pushnumber(L, c->R[2]);
-    lua_pushnumber(L, c->R[3]); lua_pushnumber(L, c->R[4]); lua_pushnumber(L, c->R[5]);
-    lua_pushnumber(L, c->R[6]); lua_pushnumber(L, c->R[7]); lua_pushnumber(L, c->R[8]);
+    lua_pushnumber(L, c->r(0,0)); lua_pushnumber(L, c->r(0,1)); lua_pushnumber(L, c->r(0,2));
+    lua_pushnumber(L, c->r(1,0)); lua_pushnumber(L, c->r(1,1)); lua_pushnumber(L, c->r(1,2));
+    lua_pushnumber(L, c->r(2,0)); lua_pushnumber(L, c->r(2,1)); lua_pushnumber(L, c->r(2,2));
     return 12;
 }
 
@@ -435,24 +539,144 @@ static int cf_tostring(lua_State* L){
     const auto* c = lb::check<CFrame>(L,1);
     lua_pushfstring(L,"%f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f",
         c->p.x, c->p.y, c->p.z,
-        c->R[0], c->R[1], c->R[2],
-        c->R[3], c->R[4], c->R[5],
-        c->R[6], c->R[7], c->R[8]);
+        c->r(0,0), c->r(0,1), c->r(0,2),
+        c->r(1,0), c->r(1,1), c->r(1,2),
+        c->r(2,0), c->r(2,1), c->r(2,2));
+    return 1;
+}
+
+// ---- Buffer kernels ----
+// Batch versions of the transform math for scripts that move many parts: inputs
+// and outputs are buffers of packed CFrames (CFrame::PackedSize bytes each) or
+// packed points (3 floats), so a whole set is transformed in one call without a
+// userdata per element. Element indices are 0-based, like buffer offsets.
+
+static const size_t kPackedPointSize = 3 * sizeof(float);
+
+// Element count argument; rejects negatives
+static size_t checkCount(lua_State* L, int idx) {
+    const int n = luaL_checkinteger(L, idx);
+    luaL_argcheck(L, n >= 0, idx, "count must not be negative");
+    return (size_t)n;
+}
+
+// Buffer argument that must hold 'n' elements of 'stride' bytes
+static char* checkPacked(lua_State* L, int idx, size_t n, size_t stride) {
+    size_t len = 0;
+    char* data = static_cast<char*>(luaL_checkbuffer(L, idx, &len));
+    if (n > len / stride) luaL_error(L, "buffer #%d holds %d elements, %d requested", idx, (int)(len / stride), (int)n);
+    return data;
+}
+
+// A CFrame operand: one CFrame applied to every element, or a buffer of n
+struct PackedCFrames {
+    const CFrame* one = nullptr;
+    const char* data = nullptr;
+    CFrame at(size_t i) const { return one ? *one : CFrame::unpack(data + i * CFrame::PackedSize); }
+};
+
+static PackedCFrames checkCFrames(lua_State* L, int idx, size_t n) {
+    PackedCFrames in;
+    if (const auto* cf = lb::test<CFrame>(L, idx)) in.one = cf;
+    else in.data = checkPacked(L, idx, n, CFrame::PackedSize);
+    return in;
+}
+
+// CFrame.batchMul(a, b, out, n): out[i] = a[i] * b[i]; a or b may be a single CFrame
+static int cf_s_batchMul(lua_State* L) {
+    const size_t n = checkCount(L, 4);
+    const PackedCFrames a = checkCFrames(L, 1, n);
+    const PackedCFrames b = checkCFrames(L, 2, n);
+    char* out = checkPacked(L, 3, n, CFrame::PackedSize);
+    for (size_t i = 0; i < n; ++i)
+        (a.at(i) * b.at(i)).pack(out + i * CFrame::PackedSize);
+    return 0;
+}
+
+// CFrame.batchLerp(a, b, out, n, alpha): out[i] = a[i]:Lerp(b[i], alpha), where
+// alpha is a number or a buffer of n f32 values
+static int cf_s_batchLerp(lua_State* L) {
+    const size_t n = checkCount(L, 4);
+    const PackedCFrames a = checkCFrames(L, 1, n);
+    const PackedCFrames b = checkCFrames(L, 2, n);
+    char* out = checkPacked(L, 3, n, CFrame::PackedSize);
+    if (lua_isbuffer(L, 5)) {
+        const char* alphas = checkPacked(L, 5, n, sizeof(float));
+        for (size_t i = 0; i < n; ++i) {
+            float alpha;
+            std::memcpy(&alpha, alphas + i * sizeof(float), sizeof(float));
+            a.at(i).lerp(b.at(i), alpha).pack(out + i * CFrame::PackedSize);
+        }
+    } else {
+        const float alpha = (float)luaL_checknumber(L, 5);
+        for (size_t i = 0; i < n; ++i)
+            a.at(i).lerp(b.at(i), alpha).pack(out + i * CFrame::PackedSize);
+    }
+    return 0;
+}
+
+// out[i] = c0*v.x + c1*v.y + c2*v.z + t for every packed point; the columns stay
+// in registers for the whole loop
+static void transformPoints(v4 c0, v4 c1, v4 c2, v4 t, const char* in, char* out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        float v[3], w[4];
+        std::memcpy(v, in + i * kPackedPointSize, sizeof(v));
+        store(w, add(combine(c0, c1, c2, v[0], v[1], v[2]), t));
+        std::memcpy(out + i * kPackedPointSize, w, kPackedPointSize);
+    }
+}
+
+// CFrame.pointsToWorldSpace(cf, in, out, n): packed points through cf
+static int cf_s_pointsToWorldSpace(lua_State* L) {
+    const auto* cf = lb::check<CFrame>(L, 1);
+    const size_t n = checkCount(L, 4);
+    const char* in = checkPacked(L, 2, n, kPackedPointSize);
+    char* out = checkPacked(L, 3, n, kPackedPointSize);
+    transformPoints(load(cf->col[0]), load(cf->col[1]), load(cf->col[2]), load(&cf->p.x), in, out, n);
+    return 0;
+}
+
+// CFrame.pointsToObjectSpace(cf, in, out, n): packed points into cf's space
+static int cf_s_pointsToObjectSpace(lua_State* L) {
+    const CFrame inv = lb::check<CFrame>(L, 1)->inverse();
+    const size_t n = checkCount(L, 4);
+    const char* in = checkPacked(L, 2, n, kPackedPointSize);
+    char* out = checkPacked(L, 3, n, kPackedPointSize);
+    transformPoints(load(inv.col[0]), load(inv.col[1]), load(inv.col[2]), load(&inv.p.x), in, out, n);
+    return 0;
+}
+
+// CFrame.readBuffer(buf, i) -> CFrame
+static int cf_s_readBuffer(lua_State* L) {
+    const int i = luaL_checkinteger(L, 2);
+    luaL_argcheck(L, i >= 0, 2, "index must not be negative");
+    const char* data = checkPacked(L, 1, (size_t)i + 1, CFrame::PackedSize);
+    lb::push(L, CFrame::unpack(data + (size_t)i * CFrame::PackedSize));
     return 1;
 }
 
+// CFrame.writeBuffer(buf, i, cf)
+static int cf_s_writeBuffer(lua_State* L) {
+    const int i = luaL_checkinteger(L, 2);
+    luaL_argcheck(L, i >= 0, 2, "index must not be negative");
+    const auto* cf = lb::check<CFrame>(L, 3);
+    char* data = checkPacked(L, 1, (size_t)i + 1, CFrame::PackedSize);
+    cf->pack(data + (size_t)i * CFrame::PackedSize);
+    return 0;
+}
+
 static int cf_index(lua_State* L) {
     auto* cf = lb::check<CFrame>(L, 1);
     const char* key = luaL_checkstring(L, 2);
 
     if (strcmp(key,"Position")==0 || strcmp(key,"p")==0) { lb::push(L, cf->p); return 1; }
-    if (strcmp(key,"XVector")==0 || strcmp(key,"RightVector")==0) { lb::push(L, Vector3Game{cf->R[0],cf->R[3],cf->R[6]}); return 1; }
-    if (strcmp(key,"YVector")==0 || strcmp(key,"UpVector")==0)     { lb::push(L, Vector3Game{cf->R[1],cf->R[4],cf->R[7]}); return 1; }
-    if (strcmp(key,"ZVector")==0)                                   { lb::push(L, Vector3Game{cf->R[2],cf->R[5],cf->R[8]}); return 1; }
-    if (strcmp(key,"LookVector")==0)                                { lb::push(L, Vector3Game{-cf->R[2],-cf->R[5],-cf->R[8]}); return 1; }
+    if (strcmp(key,"XVector")==0 || strcmp(key,"RightVector")==0) { lb::push(L, Vector3Game{cf->r(0,0),cf->r(1,0),cf->r(2,0)}); return 1; }
+    if (strcmp(key,"YVector")==0 || strcmp(key,"UpVector")==0)     { lb::push(L, Vector3Game{cf->r(0,1),cf->r(1,1),cf->r(2,1)}); return 1; }
+    if (strcmp(key,"ZVector")==0)                                   { lb::push(L, Vector3Game{cf->r(0,2),cf->r(1,2),cf->r(2,2)}); return 1; }
+    if (strcmp(key,"LookVector")==0)                                { lb::push(L, Vector3Game{-cf->r(0,2),-cf->r(1,2),-cf->r(2,2)}); return 1; }
 
     // fallback: methods table
-    luaL_getmetatable(L, lb::Traits<CFrame>::MetaName()); // mt
+    lua_getuserdatametatable(L, (int)lb::UserdataTag::CFrame); // mt
     lua_getfield(L, -1, "__methods");                     // mt, methods
     lua_pushvalue(L, 2);                                  // mt, methods, key
     lua_rawget(L, -2);                                    // mt, methods, value
@@ -507,7 +731,7 @@ static int cf_s_fromMatrix(lua_State* L){
     const auto* x   = lb::check<Vector3Game>(L, 2);
     const auto* y   = lb::check<Vector3Game>(L, 3);
     Vector3Game z;
-    if (lua_gettop(L) >= 4 && luaL_testudata(L, 4, Traits<Vector3Game>::MetaName())) {
+    if (lua_gettop(L) >= 4 && lua_isvector(L, 4)) {
         z = *lb::check<Vector3Game>(L, 4);
     } else {
         z = (*x).cross(*y);
@@ -557,6 +781,12 @@ static const luaL_Reg CF_STATICS[] = {
     {"fromOrientation", cf_s_fromOrientation},
     {"fromMatrix", cf_s_fromMatrix},
     {"lookAt", cf_s_lookAt},
+    {"batchMul", cf_s_batchMul},
+    {"batchLerp", cf_s_batchLerp},
+    {"pointsToWorldSpace", cf_s_pointsToWorldSpace},
+    {"pointsToObjectSpace", cf_s_pointsToObjectSpace},
+    {"readBuffer", cf_s_readBuffer},
+    {"writeBuffer", cf_s_writeBuffer},
     {nullptr, nullptr}
 };
 
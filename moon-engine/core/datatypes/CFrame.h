@@ -2,13 +2,22 @@
 #include "LuaDatatypes.h"
 #include "Vector3Game.h"
 
+#include <type_traits>
+
 struct CFrame {
-    // 3x3 rotation (row-major) + translation p
-    // Row 0: (R[0], R[1], R[2])
-    // Row 1: (R[3], R[4], R[5])
-    // Row 2: (R[6], R[7], R[8])
-    float R[9];
+    // Column-major 3x4 affine transform: one 4-float column per basis vector,
+    // then the translation p.
+    //   col[0] = right (R00, R10, R20), col[1] = up (R01, R11, R21),
+    //   col[2] = back  (R02, R12, R22)
+    // Lane 3 of every column (and 'pad' after p) is padding, so each column loads
+    // into one SSE/NEON register. Lua userdata is only 8-byte aligned, so the
+    // struct is not alignas(16) and the SIMD paths use unaligned loads.
+    float col[3][4];
     Vector3Game p;
+    float pad;
+
+    // Rotation element at (row, column)
+    float r(int row, int column) const { return col[column][row]; }
 
     // --- Ctors ---
     CFrame();
@@ -17,10 +26,6 @@ struct CFrame {
            float r10,float r11,float r12,
            float r20,float r21,float r22,
            const Vector3Game& pos);
-    
-    // Copy constructor and assignment operator
-    CFrame(const CFrame& other);
-    CFrame& operator=(const CFrame& other);
 
     // --- Operators ---
     CFrame operator*(const CFrame& other) const;       // compose transforms
@@ -29,7 +34,7 @@ struct CFrame {
 
     // --- Core Methods ---
     CFrame inverse() const;
-    CFrame lerp(const CFrame& goal, float alpha) const;
+    CFrame lerp(const CFrame& goal, float alpha) const;          // slerp rotation, lerp position
     void toEulerAnglesXYZ(float& rx, float& ry, float& rz) const; // radians
     void toEulerAnglesYXZ(float& rx, float& ry, float& rz) const; // radians
     void toAxisAngle(Vector3Game& axis, float& angle) const;      // axis unit, angle radians
@@ -44,9 +49,9 @@ struct CFrame {
     Vector3Game vectorToObjectSpace(const Vector3Game& v) const;    // R^T*v
 
     // Basis vectors (engine convention)
-    Vector3Game rightVector() const { return {R[0], R[3], R[6]}; }
-    Vector3Game upVector()    const { return {R[1], R[4], R[7]}; }
-    Vector3Game lookVector()  const { return {R[2], R[5], R[8]}; }
+    Vector3Game rightVector() const { return {col[0][0], col[0][1], col[0][2]}; }
+    Vector3Game upVector()    const { return {col[1][0], col[1][1], col[1][2]}; }
+    Vector3Game lookVector()  const { return {col[2][0], col[2][1], col[2][2]}; }
 
     // --- Static Constructors (radians) ---
     static CFrame Angles(float rx, float ry, float rz);           // rotation only
@@ -62,11 +67,23 @@ struct CFrame {
 
     // Utilities
     CFrame orthonormalized(float eps = 1e-6f) const;
+    CFrame withRotationOf(const CFrame& rot) const;               // rot's rotation, this position
+
+    // --- Packed form (buffers) ---
+    // 12 floats in GetComponents order: x, y, z, R00, R01, R02, ..., R22.
+    // pack/unpack go through memcpy, so any byte offset works, aligned or not.
+    static constexpr size_t PackedSize = 12 * sizeof(float);
+    static CFrame unpack(const void* src);
+    void pack(void* dst) const;
 };
 
+static_assert(std::is_trivially_copyable_v<CFrame>, "CFrame is copied as plain bytes");
+static_assert(sizeof(CFrame) == 16 * sizeof(float), "CFrame is four 16-byte columns");
+
 namespace lb {
 template<> struct Traits<CFrame> {
     static const char* MetaName()   { return "Librebox.CFrame"; }
+    static constexpr UserdataTag Tag = UserdataTag::CFrame;
     static const char* GlobalName() { return "CFrame"; }
     static lua_CFunction Ctor();
     static const luaL_Reg* Methods();
@@ -146,7 +146,7 @@ static int c3_index(lua_State* L){
     if (std::strcmp(key,"B")==0) { lua_pushnumber(L, c->b); return 1; }
 
     // Fallback to methods table
-    luaL_getmetatable(L, Traits<Color3>::MetaName());
+    lua_getuserdatametatable(L, (int)Traits<Color3>::Tag);
     lua_getfield(L, -1, "__index");            // methods table
     lua_getfield(L, -1, key);
     if (lua_isnil(L, -1)) {
@@ -42,6 +42,7 @@ struct Color3 {
 namespace lb {
 template<> struct Traits<Color3> {
     static const char* MetaName()   { return "Librebox.Color3"; }
+    static constexpr UserdataTag Tag = UserdataTag::Color3;
     static const char* GlobalName() { return "Color3"; }
     static lua_CFunction Ctor();                // Color3.new(...)
     static const luaL_Reg* Methods();           // :Lerp, :ToHSV, :ToHex
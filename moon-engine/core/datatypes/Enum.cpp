@@ -1,51 +1,32 @@
 #include "Enum.h"
+#include "LuaDatatypes.h"
 #include "lua.h"
 #include "lualib.h"
 #include <cstring>
 
 // EnumItem implementation
-EnumItem::EnumItem(const std::string& name, int value) : name(name), value(value) {}
-
-bool EnumItem::LuaGet(lua_State* L, const char* k) const {
-    if (!strcmp(k, "Name")) {
-        lua_pushstring(L, name.c_str());
-        return true;
-    }
-    if (!strcmp(k, "Value")) {
-        lua_pushinteger(L, value);
-        return true;
-    }
-    return false;
-}
+EnumItem::EnumItem(const std::string& name, int value, const Enum* enumType)
+    : name(name), value(value), enumType(enumType) {}
 
 // Enum implementation
 Enum::Enum(const std::string& enumName) : enumName(enumName) {}
 
 void Enum::AddItem(const std::string& name, int value) {
-    EnumItem* item = new EnumItem(name, value);
-    itemsByName[name] = item;
-    itemsByValue[value] = item;
+    items.push_back(std::make_unique<EnumItem>(name, value, this));
+    itemsByName[name] = items.back().get();
+    itemsByValue[value] = items.back().get();
 }
 
-EnumItem* Enum::GetItem(const std::string& name) {
+const EnumItem* Enum::GetItem(std::string_view name) const {
     auto it = itemsByName.find(name);
     return (it != itemsByName.end()) ? it->second : nullptr;
 }
 
-EnumItem* Enum::GetItem(int value) {
+const EnumItem* Enum::GetItem(int value) const {
     auto it = itemsByValue.find(value);
     return (it != itemsByValue.end()) ? it->second : nullptr;
 }
 
-bool Enum::LuaGet(lua_State* L, const char* k) const {
-    auto it = itemsByName.find(k);
-    if (it != itemsByName.end()) {
-        Lua_PushEnumItem(L, it->second);
-        return true;
-    }
-    return false;
-}
-
 // EnumRegistry implementation
 // to be honest this is a fucking mess and I hate it, but whatever it works ig
 
@@ -56,12 +37,14 @@ EnumRegistry& EnumRegistry::Instance() {
 }
 
 void EnumRegistry::RegisterEnum(const std::string& name, Enum* enumObj) {
-    enums[name] = enumObj;
+    for (auto& item : enumObj->items) item->id = itemCount++;
+    ordered.push_back(enumObj);
+    enums[name].reset(enumObj);
 }
 
-Enum* EnumRegistry::GetEnum(const std::string& name) {
+const Enum* EnumRegistry::GetEnum(std::string_view name) const {
     auto it = enums.find(name);
-    return (it != enums.end()) ? it->second : nullptr;
+    return (it != enums.end()) ? it->second.get() : nullptr;
 }
 
 void EnumRegistry::InitializeBuiltinEnums() {
@@ -140,6 +123,15 @@ void EnumRegistry::InitializeBuiltinEnums() {
     keyCode->AddItem("RightAlt", 50);
     RegisterEnum("KeyCode", keyCode);
     
+    // UserInputState enum
+    Enum* userInputState = new Enum("UserInputState");
+    userInputState->AddItem("Begin", 0);
+    userInputState->AddItem("Change", 1);
+    userInputState->AddItem("End", 2);
+    userInputState->AddItem("Cancel", 3);
+    userInputState->AddItem("None", 4);
+    RegisterEnum("UserInputState", userInputState);
+    
     // MouseButton enum
     Enum* mouseButton = new Enum("MouseButton");
     mouseButton->AddItem("MouseButton1", 1);  // Left mouse button
@@ -186,28 +178,99 @@ void EnumRegistry::InitializeBuiltinEnums() {
     RegisterEnum("PartType", partType);
 }
 
-// Lua helper functions
-void Lua_PushEnumItem(lua_State* L, EnumItem* item) {
+// ---------- Lua ----------
+// EnumItems are tagged userdata holding a const EnumItem*. Lua_RegisterEnums
+// creates one per item and keeps it in the array part of the EnumItem metatable,
+// at slot id + 1: the tag gives the metatable without a lookup, so a push is two
+// array reads and never allocates. The metatable is locked so scripts cannot
+// reach the cache.
+
+static int l_enumitem_index(lua_State* L) {
+    const EnumItem* item = Lua_ToEnumItem(L, 1);
+    size_t len = 0;
+    int atom = -1;
+    const char* key = lua_tolstringatom(L, 2, &len, &atom);
+    if (!item || !key) luaL_error(L, "invalid EnumItem access");
+    if (atom < 0) atom = lb::atom_for(key, len); // VM without the atom callback
+
+    switch (static_cast<lb::Atom>(atom)) {
+    case lb::Atom::Name:  lua_pushstring(L, item->GetName().c_str()); return 1;
+    case lb::Atom::Value: lua_pushinteger(L, item->GetValue()); return 1;
+    default: break;
+    }
+    luaL_error(L, "%s is not a valid member of EnumItem", key);
+    return 0;
+}
+
+static int l_enumitem_newindex(lua_State* L) {
+    luaL_error(L, "EnumItem is read-only");
+    return 0;
+}
+
+static int l_enumitem_tostring(lua_State* L) {
+    const EnumItem* item = Lua_ToEnumItem(L, 1);
+    if (!item) luaL_typeerrorL(L, 1, "EnumItem");
+    lua_pushfstring(L, "Enum.%s.%s", item->GetEnumType()->GetName().c_str(), item->GetName().c_str());
+    return 1;
+}
+
+void Lua_RegisterEnums(lua_State* L) {
+    const EnumRegistry& registry = EnumRegistry::Instance();
+
+    // Item metatable, doubling as the item cache
+    lua_createtable(L, registry.ItemCount(), 6);
+    lua_pushcfunction(L, l_enumitem_index, "__index");       lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, l_enumitem_newindex, "__newindex"); lua_setfield(L, -2, "__newindex");
+    lua_pushcfunction(L, l_enumitem_tostring, "__tostring"); lua_setfield(L, -2, "__tostring");
+    lua_pushstring(L, "EnumItem");                           lua_setfield(L, -2, "__type");
+    lua_pushstring(L, "The metatable is locked");            lua_setfield(L, -2, "__metatable");
+    lb::set_tag_metatable(L, lb::UserdataTag::EnumItem);     // mt
+
+    // Enum global: Enum.<Enum>.<Item>, plain read-only tables so lookups are table hits
+    lua_createtable(L, 0, (int)registry.GetEnums().size()); // mt, Enum
+    for (const Enum* e : registry.GetEnums()) {
+        lua_createtable(L, 0, (int)e->GetItems().size());   // mt, Enum, E
+        for (const auto& item : e->GetItems()) {
+            auto* slot = static_cast<const EnumItem**>(
+                lb::new_tagged(L, sizeof(const EnumItem*), lb::UserdataTag::EnumItem));
+            *slot = item.get();
+            lua_pushvalue(L, -1);
+            lua_rawseti(L, -5, item->GetId() + 1);          // mt[id + 1] = item
+            lua_setfield(L, -2, item->GetName().c_str());   // E[name] = item
+        }
+        lua_setreadonly(L, -1, true);
+        lua_setfield(L, -2, e->GetName().c_str());
+    }
+    lua_setreadonly(L, -1, true);
+    lua_setglobal(L, "Enum");
+
+    lua_setreadonly(L, -1, true);
+    lua_pop(L, 1);
+}
+
+void Lua_PushEnumItem(lua_State* L, const EnumItem* item) {
     if (!item) {
         lua_pushnil(L);
         return;
     }
-    
-    // Create a simple table with Name and Value properties so people like you can access them
-    lua_createtable(L, 0, 2);
-    lua_pushstring(L, item->GetName().c_str());
-    lua_setfield(L, -2, "Name");
-    lua_pushinteger(L, item->GetValue());
-    lua_setfield(L, -2, "Value");
+    lua_getuserdatametatable(L, static_cast<int>(lb::UserdataTag::EnumItem));
+    lua_rawgeti(L, -1, item->GetId() + 1);
+    lua_remove(L, -2);
 }
 
-void Lua_PushEnum(lua_State* L, Enum* enumObj) {
-    if (!enumObj) {
-        lua_pushnil(L);
-        return;
+const EnumItem* Lua_ToEnumItem(lua_State* L, int idx) {
+    auto* slot = static_cast<const EnumItem**>(lb::to_tagged(L, idx, lb::UserdataTag::EnumItem));
+    return slot ? *slot : nullptr;
+}
+
+bool Lua_ToEnumValue(lua_State* L, int idx, int& out) {
+    if (const EnumItem* item = Lua_ToEnumItem(L, idx)) {
+        out = item->GetValue();
+        return true;
     }
-    
-    // Create a simple table - for now we'll just return an empty table
-    // In a full implementation, this would contain all enum the fucking roblox enums items, i hope so? pls work
-    lua_createtable(L, 0, 0);
+    if (lua_type(L, idx) == LUA_TNUMBER) {
+        out = (int)lua_tointeger(L, idx);
+        return true;
+    }
+    return false;
 }
@@ -1,57 +1,82 @@
 #pragma once
 #include "lua.h"
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
+
+class Enum;
 
 // Base enum item class
 class EnumItem {
 public:
-    EnumItem(const std::string& name, int value);
-    
+    EnumItem(const std::string& name, int value, const Enum* enumType);
+
     const std::string& GetName() const { return name; }
     int GetValue() const { return value; }
-    
-    // Lua bindings
-    bool LuaGet(lua_State* L, const char* k) const;
-    
+    const Enum* GetEnumType() const { return enumType; }
+    int GetId() const { return id; }
+
 private:
+    friend class EnumRegistry;
     std::string name;
     int value;
+    const Enum* enumType;
+    int id = -1; // slot in every VM's item cache, assigned by EnumRegistry::RegisterEnum
 };
 
 // Enum class that contains enum items
 class Enum {
 public:
     Enum(const std::string& enumName);
-    
+
     void AddItem(const std::string& name, int value);
-    EnumItem* GetItem(const std::string& name);
-    EnumItem* GetItem(int value);
-    
-    // Lua bindings
-    bool LuaGet(lua_State* L, const char* k) const;
-    
+    const EnumItem* GetItem(std::string_view name) const;
+    const EnumItem* GetItem(int value) const;
+
+    const std::string& GetName() const { return enumName; }
+    const std::vector<std::unique_ptr<EnumItem>>& GetItems() const { return items; }
+
 private:
+    friend class EnumRegistry;
+
+    // string_view lookups without building a std::string
+    struct NameHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+    };
+
     std::string enumName;
-    std::unordered_map<std::string, EnumItem*> itemsByName;
-    std::unordered_map<int, EnumItem*> itemsByValue;
+    std::vector<std::unique_ptr<EnumItem>> items; // declaration order; items never move
+    std::unordered_map<std::string, const EnumItem*, NameHash, std::equal_to<>> itemsByName;
+    std::unordered_map<int, const EnumItem*> itemsByValue;
 };
 
 // Global enum registry
 class EnumRegistry {
 public:
     static EnumRegistry& Instance();
-    
-    void RegisterEnum(const std::string& name, Enum* enumObj);
-    Enum* GetEnum(const std::string& name);
-    
+
+    void RegisterEnum(const std::string& name, Enum* enumObj); // takes ownership
+    const Enum* GetEnum(std::string_view name) const;
+    const std::vector<const Enum*>& GetEnums() const { return ordered; }
+    int ItemCount() const { return itemCount; }
+
     // Initialize built-in enums
     void InitializeBuiltinEnums();
-    
+
 private:
-    std::unordered_map<std::string, Enum*> enums;
+    std::unordered_map<std::string, std::unique_ptr<Enum>, Enum::NameHash, std::equal_to<>> enums;
+    std::vector<const Enum*> ordered;
+    int itemCount = 0;
 };
 
 // Helper functions for Lua
-void Lua_PushEnumItem(lua_State* L, EnumItem* item);
-void Lua_PushEnum(lua_State* L, Enum* enumObj);
+// Every EnumItem has one canonical userdata per VM (tagged EnumItem, created by
+// Lua_RegisterEnums), so pushes never allocate and == is identity.
+void Lua_RegisterEnums(lua_State* L);   // the Enum global and the item cache
+void Lua_PushEnumItem(lua_State* L, const EnumItem* item);
+const EnumItem* Lua_ToEnumItem(lua_State* L, int idx); // nullptr if idx is not an EnumItem
+// Value of an EnumItem or a plain number at idx; false for anything else
+bool Lua_ToEnumValue(lua_State* L, int idx, int& out);
@@ -3,35 +3,82 @@
 #include "lualib.h"    // Luau's aux API
 #include <new>         // placement new
 #include <cstring>     // For strcmp
+#include <cstdint>
 
 namespace lb {
 
 template<typename T> struct Traits;
 
-// new userdata + set metatable
+// Userdata tags. Every engine userdata type is created with its own tag, and the VM
+// keeps that type's metatable per tag, so checking an argument's type is a tag
+// compare instead of a registry lookup by name plus a metatable comparison.
+// Tag 0 is plain lua_newuserdata.
+enum class UserdataTag : int {
+    None = 0,
+    CFrame, Vector2, Color3, Random,
+    Instance, Signal, Connection, Tween, TweenInfo, InputObject,
+    EnumItem,
+    Count
+};
+static_assert(static_cast<int>(UserdataTag::Count) <= LUA_UTAG_LIMIT, "too many userdata tags");
+
+// String atoms. The VM asks for a string's atom once, the first time a
+// lua_tostringatom / lua_namecallatom call sees that string, so hot __index and
+// __namecall handlers can switch on an integer instead of running strcmp chains.
+// Installed as lua_Callbacks::useratom by LuaScheduler.
+enum class Atom : int16_t {
+    Name, Value,
+    Count
+};
+
+inline int16_t atom_for(const char* s, size_t len) {
+    static const char* const names[] = { "Name", "Value" };
+    static_assert(sizeof(names) / sizeof(names[0]) == static_cast<size_t>(Atom::Count), "atom name missing");
+    for (int16_t i = 0; i < static_cast<int16_t>(Atom::Count); ++i)
+        if (std::strlen(names[i]) == len && std::memcmp(names[i], s, len) == 0) return i;
+    return -1;
+}
+
+// Makes the metatable on top of the stack the one every userdata with 'tag' gets.
+// Leaves the metatable on the stack. Once per VM and tag.
+inline void set_tag_metatable(lua_State* L, UserdataTag tag) {
+    lua_pushvalue(L, -1);
+    lua_setuserdatametatable(L, static_cast<int>(tag));
+}
+
+// New userdata with 'tag' and its registered metatable
+inline void* new_tagged(lua_State* L, size_t size, UserdataTag tag) {
+    return lua_newuserdatataggedwithmetatable(L, size, static_cast<int>(tag));
+}
+
+// Userdata at idx if it carries 'tag', nullptr otherwise
+inline void* to_tagged(lua_State* L, int idx, UserdataTag tag) {
+    return lua_touserdatatagged(L, idx, static_cast<int>(tag));
+}
+
+// Same, but raises "<tname> expected" for anything else
+inline void* check_tagged(lua_State* L, int idx, UserdataTag tag, const char* tname) {
+    void* p = lua_touserdatatagged(L, idx, static_cast<int>(tag));
+    if (!p) luaL_typeerrorL(L, idx, tname);
+    return p;
+}
+
+// new userdata of T's tag (metatable comes with it)
 template<typename T>
 inline T* new_ud(lua_State* L) {
-    void* mem = lua_newuserdata(L, sizeof(T));
-    luaL_getmetatable(L, lb::Traits<T>::MetaName());
-    lua_setmetatable(L, -2);
-    return static_cast<T*>(mem);
+    return static_cast<T*>(new_tagged(L, sizeof(T), lb::Traits<T>::Tag));
 }
 
 // strong check
 template<typename T>
 inline const T* check(lua_State* L, int idx) {
-    return static_cast<const T*>(luaL_checkudata(L, idx, lb::Traits<T>::MetaName()));
+    return static_cast<const T*>(check_tagged(L, idx, lb::Traits<T>::Tag, lb::Traits<T>::GlobalName()));
 }
 
-// optional testudata (Luau doesn’t provide it)
-inline void* luaL_testudata(lua_State* L, int idx, const char* tname) {
-    if (lua_getmetatable(L, idx)) {
-        luaL_getmetatable(L, tname);
-        const bool eq = lua_rawequal(L, -1, -2);
-        lua_pop(L, 2);
-        return eq ? lua_touserdata(L, idx) : nullptr;
-    }
-    return nullptr;
+// optional check: nullptr when idx is not a T
+template<typename T>
+inline const T* test(lua_State* L, int idx) {
+    return static_cast<const T*>(to_tagged(L, idx, lb::Traits<T>::Tag));
 }
 
 // push value by constructing in-place
@@ -56,6 +103,8 @@ inline void push(lua_State* L, const T& v) {
 template<typename T>
 inline void register_type(lua_State* L) {
     if (luaL_newmetatable(L, lb::Traits<T>::MetaName())) {
+        lua_pushstring(L, lb::Traits<T>::GlobalName());
+        lua_setfield(L, -2, "__type");           // typeof(v)
         // build methods table
         lua_newtable(L);                         // mt, methods
         if (const luaL_Reg* m = lb::Traits<T>::Methods()) {
@@ -75,6 +124,7 @@ inline void register_type(lua_State* L) {
                 lua_setfield(L, -2, r->name);
             }
         }
+        set_tag_metatable(L, lb::Traits<T>::Tag);
     }
     lua_pop(L, 1);
 
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <limits>
 #include <cstring>
+#include <stdexcept>
 
 using namespace lb;
 
@@ -24,6 +25,51 @@ uint64_t Random::mix64(uint64_t x){
     return x ^ (x >> 31);
 }
 
+// --------- Multi-stream PCG (bulk fills) ---------
+// Four independent PCG32 streams stepped side by side. The lanes share no state,
+// so their multiplies overlap instead of waiting on one LCG chain, and the loop
+// vectorizes on targets with 64-bit lane multiplies.
+struct Random::Lanes {
+    static constexpr int N = 4;
+    uint64_t state[N];
+    uint64_t inc[N];
+
+    void next(uint32_t out[N]) {
+        for (int l = 0; l < N; ++l) out[l] = pcg32_step(state[l], inc[l]);
+    }
+
+    // Unbiased value in [0, span) from lane l; span is at most 2^32 (Lemire's method)
+    uint32_t below(int l, uint64_t span) {
+        uint32_t x = pcg32_step(state[l], inc[l]);
+        if (span > 0xFFFFFFFFull) return x;
+        const uint32_t s = (uint32_t)span;
+        uint64_t m = (uint64_t)x * s;
+        if ((uint32_t)m < s) {
+            const uint32_t threshold = (uint32_t)(0u - s) % s;
+            while ((uint32_t)m < threshold) {
+                x = pcg32_step(state[l], inc[l]);
+                m = (uint64_t)x * s;
+            }
+        }
+        return (uint32_t)(m >> 32);
+    }
+};
+
+// Seeds each lane the way the seeded constructor does, from fresh draws of this generator
+Random::Lanes Random::SplitLanes() {
+    Lanes lanes;
+    for (int l = 0; l < Lanes::N; ++l) {
+        const uint64_t s0 = pcg64();
+        const uint64_t s1 = pcg64();
+        lanes.state[l] = 0;
+        lanes.inc[l]   = (s1 << 1u) | 1u;
+        pcg32_step(lanes.state[l], lanes.inc[l]);
+        lanes.state[l] += s0;
+        pcg32_step(lanes.state[l], lanes.inc[l]);
+    }
+    return lanes;
+}
+
 // --------- Constructors ---------
 Random::Random(){
     std::random_device rd;
@@ -87,27 +133,94 @@ void Random::Shuffle(lua_State* L, int tblIndex){
     if (tblIndex < 0) tblIndex = lua_gettop(L) + 1 + tblIndex;
     if (!lua_istable(L, tblIndex)) { luaL_error(L, "Shuffle expects a table"); return; }
 
-    lua_Integer n = 0;
-    lua_pushnil(L);
-    while (lua_next(L, tblIndex) != 0) {
-        if (lua_type(L, -2) == LUA_TNUMBER) {
-            lua_Number k = lua_tonumber(L, -2);
-            lua_Integer ik = (lua_Integer)k;
-            if (k == (lua_Number)ik && ik > 0) if (ik > n) n = ik;
-        }
+    const int n = lua_objlen(L, tblIndex);
+    for (int i = 1; i <= n; ++i){
+        if (lua_rawgeti(L, tblIndex, i) == LUA_TNIL) { lua_pop(L, 1); luaL_error(L, "Shuffle requires contiguous array"); return; }
         lua_pop(L, 1);
     }
-    for (lua_Integer i = 1; i <= n; ++i){
-        lua_rawgeti(L, tblIndex, (int)i);
-        if (lua_isnil(L, -1)) { lua_pop(L, 1); luaL_error(L, "Shuffle requires contiguous array"); return; }
-        lua_pop(L, 1);
+    if (n < 2) return;
+
+    // Fisher-Yates with raw accesses. The length comes from lua_objlen rather than
+    // a lua_next scan, and the swap indices from the multi-stream generator.
+    Lanes lanes = SplitLanes();
+    for (int i = n; i >= 2; --i){
+        const int j = (int)lanes.below(i % Lanes::N, (uint64_t)i) + 1;
+        if (j == i) continue;
+        lua_rawgeti(L, tblIndex, i);
+        lua_rawgeti(L, tblIndex, j);
+        lua_rawseti(L, tblIndex, i);
+        lua_rawseti(L, tblIndex, j);
+    }
+}
+
+// --------- Bulk generation ---------
+void Random::NextNumbers(void* out, size_t n, double min, double max){
+    if (!(min <= max)) throw std::runtime_error("NextNumbers: min > max");
+    Lanes lanes = SplitLanes();
+    const double span = max - min;
+    char* dst = static_cast<char*>(out);
+    uint32_t hi[Lanes::N], lo[Lanes::N];
+    for (size_t i = 0; i < n; i += Lanes::N){
+        lanes.next(hi);
+        lanes.next(lo);
+        const size_t count = std::min<size_t>(Lanes::N, n - i);
+        for (size_t l = 0; l < count; ++l){
+            // Same 53-bit mapping as NextNumber()
+            const uint64_t t = (((uint64_t)hi[l] << 32 | lo[l]) >> 11) & ((1ULL << 53) - 1ULL);
+            const double v = min + span * ((double)t / 9007199254740991.0);
+            std::memcpy(dst + (i + l) * sizeof(double), &v, sizeof(double));
+        }
+    }
+}
+
+void Random::NextIntegers(void* out, size_t n, int32_t min, int32_t max){
+    if (min > max) throw std::runtime_error("NextIntegers: min > max");
+    Lanes lanes = SplitLanes();
+    const uint64_t span = (uint64_t)((int64_t)max - (int64_t)min) + 1ULL;
+    char* dst = static_cast<char*>(out);
+    for (size_t i = 0; i < n; ++i){
+        const int32_t v = (int32_t)((int64_t)min + lanes.below((int)(i % Lanes::N), span));
+        std::memcpy(dst + i * sizeof(int32_t), &v, sizeof(int32_t));
+    }
+}
+
+void Random::NextUnitVectors(void* out, size_t n){
+    // z uniform in [-1, 1] and an angle uniform around it: uniform on the sphere, as NextUnitVector()
+    const float TAU = 6.28318530717958647692f;
+    const float unit = 1.0f / 16777216.0f; // 2^-24
+    Lanes lanes = SplitLanes();
+    char* dst = static_cast<char*>(out);
+    uint32_t a[Lanes::N], b[Lanes::N];
+    for (size_t i = 0; i < n; i += Lanes::N){
+        lanes.next(a);
+        lanes.next(b);
+        const size_t count = std::min<size_t>(Lanes::N, n - i);
+        for (size_t l = 0; l < count; ++l){
+            const float z = (float)(a[l] >> 8) * unit * 2.0f - 1.0f;
+            const float t = (float)(b[l] >> 8) * unit * TAU;
+            const float r = std::sqrt(std::max(0.0f, 1.0f - z*z));
+            const float v[3] = { r * std::cos(t), r * std::sin(t), z };
+            std::memcpy(dst + (i + l) * sizeof(v), v, sizeof(v));
+        }
     }
-    for (lua_Integer i = n; i >= 2; --i){
-        int64_t j = NextInteger(1, (int64_t)i);
-        lua_rawgeti(L, tblIndex, (int)i);
-        lua_rawgeti(L, tblIndex, (int)j);
-        lua_rawseti(L, tblIndex, (int)i);
-        lua_rawseti(L, tblIndex, (int)j);
+}
+
+void Random::Shuffle(void* data, size_t n, size_t elementSize){
+    if (n < 2 || elementSize == 0) return;
+    Lanes lanes = SplitLanes();
+    char* base = static_cast<char*>(data);
+    char tmp[64];
+    for (size_t i = n - 1; i >= 1; --i){
+        const size_t j = lanes.below((int)(i % Lanes::N), (uint64_t)i + 1);
+        if (j == i) continue;
+        char* a = base + i * elementSize;
+        char* b = base + j * elementSize;
+        for (size_t k = 0; k < elementSize; k += sizeof(tmp)){
+            const size_t len = std::min(sizeof(tmp), elementSize - k);
+            std::memcpy(tmp, a + k, len);
+            std::memcpy(a + k, b + k, len);
+            std::memcpy(b + k, tmp, len);
+        }
     }
 }
 
@@ -154,8 +267,62 @@ static int r_nextunit(lua_State* L){
     return 1;
 }
 
+// Buffer argument that must hold n elements of 'size' bytes
+static void* checkFill(lua_State* L, int idx, size_t n, size_t size){
+    size_t len = 0;
+    void* data = luaL_checkbuffer(L, idx, &len);
+    if (n > len / size) luaL_error(L, "buffer holds %d elements, %d requested", (int)(len / size), (int)n);
+    return data;
+}
+
+static size_t checkCount(lua_State* L, int idx){
+    const int n = luaL_checkinteger(L, idx);
+    luaL_argcheck(L, n >= 0, idx, "count must not be negative");
+    return (size_t)n;
+}
+
+// rng:NextNumbers(buf, n [, min, max]): n f64 values
+static int r_nextnums(lua_State* L){
+    auto* r = const_cast<Random*>(lb::check<Random>(L,1));
+    const size_t n = checkCount(L, 3);
+    const double a = luaL_optnumber(L, 4, 0.0);
+    const double b = luaL_optnumber(L, 5, 1.0);
+    luaL_argcheck(L, a <= b, 5, "max must not be less than min");
+    r->NextNumbers(checkFill(L, 2, n, sizeof(double)), n, a, b);
+    return 0;
+}
+
+// rng:NextIntegers(buf, n, min, max): n i32 values
+static int r_nextints(lua_State* L){
+    auto* r = const_cast<Random*>(lb::check<Random>(L,1));
+    const size_t n = checkCount(L, 3);
+    const int64_t a = (int64_t)luaL_checkinteger(L, 4);
+    const int64_t b = (int64_t)luaL_checkinteger(L, 5);
+    luaL_argcheck(L, a >= INT32_MIN && a <= INT32_MAX, 4, "min must fit in 32 bits");
+    luaL_argcheck(L, b >= INT32_MIN && b <= INT32_MAX, 5, "max must fit in 32 bits");
+    luaL_argcheck(L, a <= b, 5, "max must not be less than min");
+    r->NextIntegers(checkFill(L, 2, n, sizeof(int32_t)), n, (int32_t)a, (int32_t)b);
+    return 0;
+}
+
+// rng:NextUnitVectors(buf, n): n packed points (3 f32), as CFrame.pointsToWorldSpace reads them
+static int r_nextunits(lua_State* L){
+    auto* r = const_cast<Random*>(lb::check<Random>(L,1));
+    const size_t n = checkCount(L, 3);
+    r->NextUnitVectors(checkFill(L, 2, n, 3 * sizeof(float)), n);
+    return 0;
+}
+
+// rng:Shuffle(tbl) or rng:Shuffle(buf, n [, elementSize = 4])
 static int r_shuffle(lua_State* L){
     auto* r = const_cast<Random*>(lb::check<Random>(L,1));
+    if (lua_isbuffer(L, 2)) {
+        const size_t n = checkCount(L, 3);
+        const int size = luaL_optinteger(L, 4, 4);
+        luaL_argcheck(L, size > 0, 4, "element size must be positive");
+        r->Shuffle(checkFill(L, 2, n, (size_t)size), n, (size_t)size);
+        return 0;
+    }
     r->Shuffle(L, 2);
     return 0;
 }
@@ -170,6 +337,9 @@ static const luaL_Reg R_METHODS[] = {
     {"NextNumber",     r_nextnum},
     {"NextUnitVector", r_nextunit},
     {"Shuffle",        r_shuffle},
+    {"NextNumbers",     r_nextnums},
+    {"NextIntegers",    r_nextints},
+    {"NextUnitVectors", r_nextunits},
     {nullptr,nullptr}
 };
 static const luaL_Reg R_META[] = {
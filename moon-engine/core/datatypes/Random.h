@@ -14,10 +14,21 @@ public:
     Vector3Game NextUnitVector();
     void Shuffle(lua_State* L, int tblIndex);
 
+    // Bulk generation. Each call splits this generator into four PCG32 streams that
+    // run side by side, so it advances by a fixed amount whatever n is and the same
+    // seed always fills the same values. 'out' needs no particular alignment.
+    void NextNumbers(void* out, size_t n, double min, double max);    // n f64
+    void NextIntegers(void* out, size_t n, int32_t min, int32_t max); // n i32
+    void NextUnitVectors(void* out, size_t n);                        // n x 3 f32
+    void Shuffle(void* data, size_t n, size_t elementSize);           // n packed elements
+
 private:
     uint64_t state_{0};
     uint64_t inc_{0};
 
+    struct Lanes;
+    Lanes SplitLanes();
+
     uint32_t pcg32();
     uint64_t pcg64();
     static uint64_t mix64(uint64_t x);
@@ -27,6 +38,7 @@ private:
 namespace lb {
 template<> struct Traits<Random> {
     static const char* MetaName()   { return "Librebox.Random"; }
+    static constexpr UserdataTag Tag = UserdataTag::Random;
     static const char* GlobalName() { return "Random"; }
     static lua_CFunction Ctor();
     static const luaL_Reg* Methods();
@@ -82,7 +82,7 @@ static int v2_index(lua_State* L) {
     }
     else {
         // Look for method in the methods table stored in metatable
-        luaL_getmetatable(L, Traits<Vector2Game>::MetaName());
+        lua_getuserdatametatable(L, (int)Traits<Vector2Game>::Tag);
         lua_getfield(L, -1, "__methods");
         if (!lua_isnil(L, -1)) {
             lua_getfield(L, -1, key);
@@ -39,6 +39,7 @@ struct Vector2Game {
 namespace lb {
 template<> struct Traits<Vector2Game> {
     static const char* MetaName()    { return "Librebox.Vector2"; }
+    static constexpr UserdataTag Tag = UserdataTag::Vector2;
     static const char* GlobalName()  { return "Vector2"; }
     static lua_CFunction Ctor();
     static const luaL_Reg* Methods();
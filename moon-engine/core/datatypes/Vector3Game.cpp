@@ -2,50 +2,19 @@
 #include <cstring> // For strcmp
 using namespace lb;
 
+// Arithmetic (+, -, *, /, unary -) and == are handled by the VM on vector values
+// directly, and X/Y/Z reads never reach __index: the VM answers them itself.
+
 // --- Constructor ---
+// Scripts are compiled with Vector3.new as the vector constructor (see
+// LuaScheduler::CompileOptions), so numeric calls become a fastcall and this
+// only runs for the leftovers: missing or non-number arguments.
 static int v3_new(lua_State* L){
     float x=(float)luaL_optnumber(L,1,0), y=(float)luaL_optnumber(L,2,0), z=(float)luaL_optnumber(L,3,0);
-    push(L, Vector3Game{x,y,z});
+    lua_pushvector(L, x, y, z);
     return 1;
 }
 
-// --- Metamethods ---
-static int v3_tostring(lua_State* L){
-    auto* v = check<Vector3Game>(L,1);
-    lua_pushfstring(L,"%f, %f, %f",v->x,v->y,v->z); return 1;
-}
-static int v3_add(lua_State* L){
-    auto* a=check<Vector3Game>(L,1); auto* b=check<Vector3Game>(L,2);
-    push(L, *a + *b); return 1;
-}
-static int v3_sub(lua_State* L){
-    auto* a=check<Vector3Game>(L,1); auto* b=check<Vector3Game>(L,2);
-    push(L, *a - *b); return 1;
-}
-static int v3_mul(lua_State* L){ // scalar * v OR v * scalar
-    if (lua_isnumber(L,1)) {
-        float s=(float)lua_tonumber(L,1); auto* v=check<Vector3Game>(L,2);
-        push(L, *v * s);
-    } else {
-        auto* v=check<Vector3Game>(L,1); float s=(float)luaL_checknumber(L,2);
-        push(L, *v * s);
-    }
-    return 1;
-}
-static int v3_div(lua_State* L){ // v / scalar
-    auto* v=check<Vector3Game>(L,1); float s=(float)luaL_checknumber(L,2);
-    if (s == 0.0f) {
-        // --- FIX WAS HERE ---
-        luaL_error(L, "division by zero");
-        return 0; 
-    }
-    push(L, *v / s); return 1;
-}
-static int v3_unm(lua_State* L){ // -v
-    auto* v=check<Vector3Game>(L,1);
-    push(L, -(*v)); return 1;
-}
-
 // --- Methods ---
 static int v3_dot(lua_State* L) {
     auto* a=check<Vector3Game>(L,1); auto* b=check<Vector3Game>(L,2);
@@ -65,7 +34,28 @@ static int v3_lerp(lua_State* L) {
     return 1;
 }
 
-// --- __index for properties and methods ---
+static const luaL_Reg V3_METHODS[] = {
+    {"Dot", v3_dot},
+    {"Cross", v3_cross},
+    {"Lerp", v3_lerp},
+    {nullptr,nullptr}
+};
+
+// --- v:Method(...) ---
+// Dispatches straight on the method name; v.Dot(v, w) goes through __index below.
+static int v3_namecall(lua_State* L) {
+    const char* name = lua_namecallatom(L, nullptr);
+    if (!name) luaL_error(L, "bad namecall on Vector3");
+
+    if (strcmp(name, "Dot") == 0)   return v3_dot(L);
+    if (strcmp(name, "Cross") == 0) return v3_cross(L);
+    if (strcmp(name, "Lerp") == 0)  return v3_lerp(L);
+
+    luaL_error(L, "invalid member '%s' for Vector3", name);
+    return 0;
+}
+
+// --- __index for properties and methods (upvalue 1 = methods table) ---
 static int v3_index(lua_State* L) {
     auto* v = check<Vector3Game>(L, 1);
     const char* key = luaL_checkstring(L, 2);
@@ -90,67 +80,45 @@ static int v3_index(lua_State* L) {
         push(L, v->normalized());
         return 1;
     }
-    else {
-        // Look for method in the methods table stored in metatable
-        luaL_getmetatable(L, Traits<Vector3Game>::MetaName());
-        lua_getfield(L, -1, "__methods");
-        if (!lua_isnil(L, -1)) {
-            lua_getfield(L, -1, key);
-            if (!lua_isnil(L, -1)) {
-                return 1; // Found the method, return it
-            }
-        }
-        
-        // Method not found
-        luaL_error(L, "invalid member '%s' for Vector3", key);
-        return 0;
-    }
-}
 
-static const luaL_Reg V3_METHODS[] = {
-    {"Dot", v3_dot},
-    {"Cross", v3_cross},
-    {"Lerp", v3_lerp},
-    {nullptr,nullptr}
-};
+    lua_rawgetfield(L, lua_upvalueindex(1), key);
+    if (!lua_isnil(L, -1)) return 1;
 
-static const luaL_Reg V3_META[] = {
-    {"__tostring", v3_tostring},
-    {"__add",      v3_add},
-    {"__sub",      v3_sub},
-    {"__mul",      v3_mul},
-    {"__div",      v3_div},
-    {"__unm",      v3_unm},
-    {"__index",    v3_index},
-    {nullptr,nullptr}
-};
+    luaL_error(L, "invalid member '%s' for Vector3", key);
+    return 0;
+}
 
-// --- Static Constants ---
-static int v3_static_index(lua_State* L) {
-    const char* key = luaL_checkstring(L, 2);
-    
-    if (strcmp(key, "zero") == 0) {
-        push(L, Vector3Game(0, 0, 0));
-        return 1;
-    }
-    else if (strcmp(key, "one") == 0) {
-        push(L, Vector3Game(1, 1, 1));
-        return 1;
-    }
-    else if (strcmp(key, "new") == 0) {
-        lua_pushcfunction(L, v3_new, "new");
-        return 1;
+void lb::register_vector3(lua_State* L) {
+    // One metatable for every vector value in the VM
+    lua_pushvector(L, 0.0f, 0.0f, 0.0f);
+    lua_newtable(L);                                 // v, mt
+
+    lua_newtable(L);                                 // v, mt, methods
+    for (const luaL_Reg* r = V3_METHODS; r->name; ++r) {
+        lua_pushcfunction(L, r->func, r->name);
+        lua_setfield(L, -2, r->name);
     }
-    
-    return 0; // Property not found
-}
+    lua_setreadonly(L, -1, true);
+    lua_pushcclosure(L, v3_index, "__index", 1);     // v, mt, __index
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, v3_namecall, "__namecall");
+    lua_setfield(L, -2, "__namecall");
+    lua_pushstring(L, "Vector3");
+    lua_setfield(L, -2, "__type");                   // typeof(v)
+    lua_setreadonly(L, -1, true);
 
-static const luaL_Reg V3_STATICS[] = {
-    {"__index", v3_static_index},
-    {nullptr, nullptr}
-};
+    lua_setmetatable(L, -2);                         // v
+    lua_pop(L, 1);
 
-lua_CFunction Traits<Vector3Game>::Ctor() { return v3_new; }
-const luaL_Reg* Traits<Vector3Game>::Methods() { return V3_METHODS; }
-const luaL_Reg* Traits<Vector3Game>::MetaMethods() { return V3_META; }
-const luaL_Reg* Traits<Vector3Game>::Statics() { return V3_STATICS; }
+    // Vector3 global; constants are plain fields since vectors are values
+    lua_newtable(L);
+    lua_pushcfunction(L, v3_new, "new");
+    lua_setfield(L, -2, "new");
+    lua_pushvector(L, 0.0f, 0.0f, 0.0f); lua_setfield(L, -2, "zero");
+    lua_pushvector(L, 1.0f, 1.0f, 1.0f); lua_setfield(L, -2, "one");
+    lua_pushvector(L, 1.0f, 0.0f, 0.0f); lua_setfield(L, -2, "xAxis");
+    lua_pushvector(L, 0.0f, 1.0f, 0.0f); lua_setfield(L, -2, "yAxis");
+    lua_pushvector(L, 0.0f, 0.0f, 1.0f); lua_setfield(L, -2, "zAxis");
+    lua_setreadonly(L, -1, true);
+    lua_setglobal(L, "Vector3");
+}
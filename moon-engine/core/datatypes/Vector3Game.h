@@ -38,14 +38,19 @@ struct Vector3Game {
     }
 };
 
-// Traits specialization
+static_assert(sizeof(Vector3Game) == 3 * sizeof(float), "Vector3Game must match a Luau vector's x, y, z");
+
+// Vector3 is Luau's native vector value (LUA_TVECTOR), not userdata: it lives in the
+// stack slot itself, so pushing one never allocates and arithmetic runs on the VM's
+// fast paths. Properties and methods come from the VM-wide vector metatable.
 namespace lb {
-template<> struct Traits<Vector3Game> {
-    static const char* MetaName()    { return "Librebox.Vector3"; }
-    static const char* GlobalName()  { return "Vector3"; }
-    static lua_CFunction Ctor();
-    static const luaL_Reg* Methods();
-    static const luaL_Reg* MetaMethods();
-    static const luaL_Reg* Statics();
-};
+inline void push(lua_State* L, const Vector3Game& v) { lua_pushvector(L, v.x, v.y, v.z); }
+
+// Points into the stack slot at 'idx'; valid while that value stays on the stack
+template<> inline const Vector3Game* check<Vector3Game>(lua_State* L, int idx) {
+    return reinterpret_cast<const Vector3Game*>(luaL_checkvector(L, idx));
+}
+
+// Vector3 global, vector metatable (Magnitude, Unit, Dot, Cross, Lerp)
+void register_vector3(lua_State* L);
 } // namespace lb
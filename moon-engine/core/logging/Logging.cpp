@@ -1,11 +1,15 @@
 #include "Logging.h"
 #include <cstdio>
+#include <mutex>
 
 namespace logging {
 
 void VLog(int level, const char* fmt, va_list ap) {
     char body[2048];
     vsnprintf(body, sizeof(body), fmt, ap);
+    // actor VMs log from worker threads during the parallel phase
+    static std::mutex mtx;
+    std::lock_guard<std::mutex> lk(mtx);
     TraceLog(level, body);
 }
 